@@ -31,6 +31,8 @@ public class NetworkReplicationSubsystem : ModuleRules
 				"CoreUObject",
 				"Engine",
 				"NetCore",
+				"IrisCore",
+				"ReplicationGraph",
 				"AnimationCore",
 				"Niagara",
 				"Chooser",
@@ -49,5 +51,11 @@ public class NetworkReplicationSubsystem : ModuleRules
 			{
 			}
 		);
+
+		// Preset dictionary support for payload compression
+		AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
+
+		// Defines UE_WITH_IRIS, which gates the Iris NetSerializers for the replicated state structs
+		SetupIrisSupport(Target);
 	}
 }
\ No newline at end of file
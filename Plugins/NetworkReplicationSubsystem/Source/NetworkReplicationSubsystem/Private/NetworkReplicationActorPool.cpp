@@ -0,0 +1,282 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationActorPool.cpp
+// Implements the per-world actor pool used by pooled replicated spawns.
+
+#include "NetworkReplicationActorPool.h"
+#include "NetworkReplicationSubsystem.h"
+#include "NetworkReplicationComponent.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "GameFramework/Actor.h"
+
+bool UNetworkReplicationActorPool::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UNetworkReplicationActorPool::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Prewarm once actors have begun play, otherwise BeginPlay would restart the life span of idle actors
+	InWorld.GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [this]()
+	{
+		UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+		UNetworkReplicationSubsystem* Subsystem = GameInstance ? GameInstance->GetSubsystem<UNetworkReplicationSubsystem>() : nullptr;
+		if (!Subsystem)
+		{
+			return;
+		}
+
+		for (const TPair<TSoftClassPtr<AActor>, int32>& Pair : Subsystem->GetActorPoolPrewarm())
+		{
+			if (UClass* ActorClass = Pair.Key.LoadSynchronous())
+			{
+				Prewarm(ActorClass, Pair.Value);
+			}
+		}
+	}));
+}
+
+void UNetworkReplicationActorPool::Deinitialize()
+{
+	// The world destroys its actors as it tears down, pooled or not
+	Pools.Empty();
+	LiveActors.Empty();
+	NumIdle = 0;
+
+	Super::Deinitialize();
+}
+
+bool UNetworkReplicationActorPool::CanPoolClass(const UClass* ActorClass)
+{
+	const AActor* Defaults = ActorClass ? ActorClass->GetDefaultObject<AActor>() : nullptr;
+	return Defaults && !Defaults->GetIsReplicated();
+}
+
+AActor* UNetworkReplicationActorPool::Acquire(TSubclassOf<AActor> ActorClass, const FVector& Location, const FRotator& Rotation, UNetworkReplicationComponent* Spawner)
+{
+	UWorld* World = GetWorld();
+	if (!ActorClass || !World)
+	{
+		return nullptr;
+	}
+
+	if (!CanPoolClass(ActorClass))
+	{
+		return World->SpawnActor<AActor>(ActorClass, Location, Rotation);
+	}
+
+	AActor* Actor = nullptr;
+	if (FNetworkReplicationActorPoolEntry* Entry = Pools.Find(ActorClass))
+	{
+		while (!Actor && Entry->Idle.Num() > 0)
+		{
+			AActor* Candidate = Entry->Idle.Pop(EAllowShrinking::No);
+			NumIdle--;
+			Actor = IsValid(Candidate) ? Candidate : nullptr;
+		}
+	}
+
+	if (Actor)
+	{
+		Actor->SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+		Hits++;
+	}
+	else
+	{
+		Actor = SpawnPooledActor(ActorClass, Location, Rotation);
+		if (!Actor)
+		{
+			return nullptr;
+		}
+		Misses++;
+	}
+
+	ActivateActor(Actor, Spawner);
+	return Actor;
+}
+
+void UNetworkReplicationActorPool::ReleaseActor(AActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	FNetworkReplicationActorPoolEntry& Entry = Pools.FindOrAdd(Actor->GetClass());
+	FLiveActor Live;
+	if (!LiveActors.RemoveAndCopyValue(Actor, Live))
+	{
+		// Releasing an idle actor twice is harmless; anything the pool never handed out is simply destroyed
+		if (!Entry.Idle.Contains(Actor))
+		{
+			Actor->Destroy();
+		}
+		return;
+	}
+
+	GetWorld()->GetTimerManager().ClearTimer(Live.LifeSpanTimer);
+	if (UNetworkReplicationComponent* Spawner = Live.Spawner.Get())
+	{
+		Spawner->OnPooledActorReleased(Actor);
+	}
+
+	if (Entry.Idle.Num() >= GetMaxPerClass())
+	{
+		Actor->OnDestroyed.RemoveAll(this);
+		Actor->Destroy();
+		Discarded++;
+		return;
+	}
+
+	DeactivateActor(Actor);
+	Entry.Idle.Add(Actor);
+	NumIdle++;
+}
+
+void UNetworkReplicationActorPool::Prewarm(TSubclassOf<AActor> ActorClass, int32 Count)
+{
+	if (!GetWorld() || !CanPoolClass(ActorClass))
+	{
+		return;
+	}
+
+	const int32 TargetIdle = FMath::Min(Count, GetMaxPerClass());
+	while (Pools.FindOrAdd(ActorClass).Idle.Num() < TargetIdle)
+	{
+		AActor* Actor = SpawnPooledActor(ActorClass, FVector::ZeroVector, FRotator::ZeroRotator);
+		if (!Actor)
+		{
+			break;
+		}
+
+		Actor->SetLifeSpan(0.0f);
+		DeactivateActor(Actor);
+		Pools.FindOrAdd(ActorClass).Idle.Add(Actor);
+		NumIdle++;
+	}
+}
+
+void UNetworkReplicationActorPool::EmptyPool()
+{
+	for (TPair<TObjectPtr<UClass>, FNetworkReplicationActorPoolEntry>& Pair : Pools)
+	{
+		for (AActor* Actor : Pair.Value.Idle)
+		{
+			if (IsValid(Actor))
+			{
+				Actor->OnDestroyed.RemoveAll(this);
+				Actor->Destroy();
+			}
+		}
+		Pair.Value.Idle.Reset();
+	}
+
+	NumIdle = 0;
+}
+
+void UNetworkReplicationActorPool::GetPoolStats(int32& OutLive, int32& OutIdle, int64& OutHits, int64& OutMisses, int64& OutDiscarded) const
+{
+	OutLive = LiveActors.Num();
+	OutIdle = NumIdle;
+	OutHits = Hits;
+	OutMisses = Misses;
+	OutDiscarded = Discarded;
+}
+
+AActor* UNetworkReplicationActorPool::SpawnPooledActor(UClass* ActorClass, const FVector& Location, const FRotator& Rotation)
+{
+	// Pooled classes are short-lived props and projectiles, placed exactly where they were asked for
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AActor* Actor = GetWorld()->SpawnActor<AActor>(ActorClass, Location, Rotation, SpawnParameters);
+	if (Actor)
+	{
+		Actor->OnDestroyed.AddUniqueDynamic(this, &UNetworkReplicationActorPool::OnPooledActorDestroyed);
+	}
+	return Actor;
+}
+
+void UNetworkReplicationActorPool::ActivateActor(AActor* Actor, UNetworkReplicationComponent* Spawner)
+{
+	const AActor* Defaults = Actor->GetClass()->GetDefaultObject<AActor>();
+	Actor->SetActorHiddenInGame(Defaults->IsHidden());
+	Actor->SetActorEnableCollision(Defaults->GetActorEnableCollision());
+	Actor->SetActorTickEnabled(Defaults->PrimaryActorTick.bStartWithTickEnabled);
+	Actor->ForEachComponent(false, [](UActorComponent* Component)
+	{
+		Component->SetComponentTickEnabled(Component->PrimaryComponentTick.bStartWithTickEnabled);
+	});
+
+	// The pool owns the life span, so running out releases the actor instead of destroying it
+	Actor->SetLifeSpan(0.0f);
+	FLiveActor& Live = LiveActors.Add(Actor);
+	Live.Spawner = Spawner;
+	if (Defaults->InitialLifeSpan > 0.0f)
+	{
+		GetWorld()->GetTimerManager().SetTimer(Live.LifeSpanTimer, FTimerDelegate::CreateUObject(this, &UNetworkReplicationActorPool::OnLifeSpanExpired, TWeakObjectPtr<AActor>(Actor)), Defaults->InitialLifeSpan, false);
+	}
+
+	if (Actor->Implements<UNetworkReplicationPooledActor>())
+	{
+		INetworkReplicationPooledActor::Execute_OnAcquiredFromPool(Actor);
+	}
+}
+
+void UNetworkReplicationActorPool::DeactivateActor(AActor* Actor)
+{
+	Actor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+	Actor->ForEachComponent(false, [](UActorComponent* Component)
+	{
+		Component->SetComponentTickEnabled(false);
+	});
+
+	if (Actor->Implements<UNetworkReplicationPooledActor>())
+	{
+		INetworkReplicationPooledActor::Execute_OnReturnedToPool(Actor);
+	}
+}
+
+void UNetworkReplicationActorPool::OnLifeSpanExpired(TWeakObjectPtr<AActor> Actor)
+{
+	if (AActor* ExpiredActor = Actor.Get())
+	{
+		ReleaseActor(ExpiredActor);
+	}
+}
+
+int32 UNetworkReplicationActorPool::GetMaxPerClass() const
+{
+	UWorld* World = GetWorld();
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	const UNetworkReplicationSubsystem* Subsystem = GameInstance ? GameInstance->GetSubsystem<UNetworkReplicationSubsystem>() : nullptr;
+	return Subsystem ? Subsystem->GetActorPoolMaxPerClass() : 32;
+}
+
+void UNetworkReplicationActorPool::OnPooledActorDestroyed(AActor* Actor)
+{
+	// Destroyed while in use, for example by gameplay calling Destroy instead of ReleaseActor
+	FLiveActor Live;
+	if (LiveActors.RemoveAndCopyValue(Actor, Live))
+	{
+		GetWorld()->GetTimerManager().ClearTimer(Live.LifeSpanTimer);
+		if (UNetworkReplicationComponent* Spawner = Live.Spawner.Get())
+		{
+			Spawner->OnPooledActorReleased(Actor);
+		}
+		return;
+	}
+
+	FNetworkReplicationActorPoolEntry* Entry = Pools.Find(Actor->GetClass());
+	if (Entry && Entry->Idle.RemoveSingleSwap(Actor) > 0)
+	{
+		NumIdle--;
+	}
+}
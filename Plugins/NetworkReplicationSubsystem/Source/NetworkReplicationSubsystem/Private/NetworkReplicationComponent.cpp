@@ -5,13 +5,19 @@
 
 #include "NetworkReplicationComponent.h"
 #include "NetworkReplicationSubsystem.h"
+#include "NetworkReplicationQuantizationProfile.h"
+#include "NetworkReplicationNiagaraPool.h"
+#include "NetworkReplicationActorPool.h"
+#include "NetworkReplicationRelayComponent.h"
 #include "Animation/AnimInstance.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Components/AudioComponent.h"
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
 #include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
 #include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
 #include "NiagaraSystem.h"
 #include "Sound/SoundBase.h"
 #include "Animation/AnimMontage.h"
@@ -23,27 +29,59 @@
 
 UNetworkReplicationComponent::UNetworkReplicationComponent()
 {
-	// Enable component ticking for continuous updates
-	PrimaryComponentTick.bCanEverTick = true;
+	// Periodic work runs from the subsystem's central tick, so components do not tick on their own
+	PrimaryComponentTick.bCanEverTick = false;
 	
 	// Enable network replication by default for multiplayer functionality
 	SetIsReplicatedByDefault(true);
+
+	// Let the variable store route client-side callbacks back to this component
+	ReplicatedVariables.OwnerComponent = this;
+	ReplicatedState.OwnerComponent = this;
 }
 
 void UNetworkReplicationComponent::BeginPlay()
 {
 	Super::BeginPlay();
 	
+	// Give the owner a full idle period before automatic dormancy considers it
+	LastReplicationActivityTime = GetWorld()->GetTimeSeconds();
+	
 	// Register this component with the network replication subsystem for centralized management
-	if (UNetworkReplicationSubsystem* Subsystem = GetWorld()->GetGameInstance()->GetSubsystem<UNetworkReplicationSubsystem>())
+	if (UNetworkReplicationSubsystem* Subsystem = GetReplicationSubsystem())
 	{
-		Subsystem->RegisterReplicationComponent(this);
+		Subsystem->AddRegisteredComponent(this);
 	}
 }
 
-void UNetworkReplicationComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UNetworkReplicationComponent::TickReplication()
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	if (NumPendingVariables > 0)
+	{
+		FlushPendingVariables();
+	}
+
+	if (NumUnackedStates > 0)
+	{
+		ResendUnackedStates();
+	}
+
+	if (CoalescedVariables.Num() > 0 || bHasCoalescedTrajectory)
+	{
+		FlushCoalescedRPCs();
+	}
+
+	if (HasPendingEventBatch())
+	{
+		FlushEventBatch();
+	}
+
+	if (ParkedNameEvents.Num() > 0)
+	{
+		ExpireParkedNameEvents();
+	}
+
+	UpdateAutoDormancy();
 }
 
 void UNetworkReplicationComponent::ReplicateAnimation(UAnimMontage* Montage, float PlayRate, float StartingPosition)
@@ -59,6 +97,7 @@ void UNetworkReplicationComponent::ReplicateAnimation(UAnimMontage* Montage, flo
 	if (GetOwner()->HasAuthority())
 	{
 		// Server: Play locally and multicast to all clients
+		ChargeSendBudget(ReplicationWireSize::RPCHeader + ReplicationWireSize::ObjectReference + 8);
 		MulticastPlayMontage(Montage, PlayRate, StartingPosition);
 	}
 	else
@@ -97,6 +136,7 @@ void UNetworkReplicationComponent::ReplicateAnimationStop(UAnimMontage* Montage)
 	if (GetOwner()->HasAuthority())
 	{
 		// Server: Stop locally and multicast to clients
+		ChargeSendBudget(ReplicationWireSize::RPCHeader + ReplicationWireSize::ObjectReference);
 		MulticastStopMontage(Montage);
 	}
 	else
@@ -117,7 +157,7 @@ void UNetworkReplicationComponent::ReplicateSound(USoundBase* Sound, float Volum
 	if (GetOwner()->HasAuthority())
 	{
 		// Server: Play locally and multicast to clients
-		MulticastPlaySound(Sound, VolumeMultiplier, PitchMultiplier, StartTime);
+		DispatchSound(Sound, VolumeMultiplier, PitchMultiplier, StartTime);
 	}
 	else
 	{
@@ -137,12 +177,12 @@ void UNetworkReplicationComponent::ReplicateSoundAtLocation(USoundBase* Sound, F
 	if (GetOwner()->HasAuthority())
 	{
 		// Server: Play locally and multicast to clients
-		MulticastPlaySoundAtLocation(Sound, Location, VolumeMultiplier, PitchMultiplier, StartTime);
+		DispatchSoundAtLocation(Sound, QuantizeField(EReplicationQuantizedField::SoundLocation, Location), VolumeMultiplier, PitchMultiplier, StartTime);
 	}
 	else
 	{
 		// Client: Send to server
-		ServerPlaySoundAtLocation(Sound, Location, VolumeMultiplier, PitchMultiplier, StartTime);
+		ServerPlaySoundAtLocation(Sound, QuantizeField(EReplicationQuantizedField::SoundLocation, Location), VolumeMultiplier, PitchMultiplier, StartTime);
 	}
 }
 
@@ -157,6 +197,7 @@ AActor* UNetworkReplicationComponent::ReplicateActorSpawn(TSubclassOf<AActor> Ac
 	if (GetOwner()->HasAuthority())
 	{
 		// Server: Spawn locally and multicast to clients
+		ChargeSendBudget(ReplicationWireSize::RPCHeader + ReplicationWireSize::ObjectReference + ReplicationWireSize::Vector + ReplicationWireSize::Rotator + 1);
 		MulticastSpawnActor(ActorClass, Location, Rotation, bAttachToOwner);
 		return nullptr; // Will be spawned via multicast
 	}
@@ -179,6 +220,7 @@ AActor* UNetworkReplicationComponent::ReplicateActorSpawnAttached(TSubclassOf<AA
 	if (GetOwner()->HasAuthority())
 	{
 		// Server: Spawn locally and multicast to clients
+		ChargeSendBudget(ReplicationWireSize::RPCHeader + ReplicationWireSize::ObjectReference + FReplicatedNameId(AttachSocketName).GetEstimatedWireBytes() + ReplicationWireSize::Vector + ReplicationWireSize::Rotator);
 		MulticastSpawnActorAttached(ActorClass, AttachSocketName, LocationOffset, RotationOffset);
 		return nullptr; // Will be spawned via multicast
 	}
@@ -190,6 +232,28 @@ AActor* UNetworkReplicationComponent::ReplicateActorSpawnAttached(TSubclassOf<AA
 	}
 }
 
+FReplicationSpawnBatchHandle UNetworkReplicationComponent::ReplicateActorSpawnBatch(const TArray<FReplicationSpawnRequest>& Requests)
+{
+	UNetworkReplicationSubsystem* Subsystem = GetReplicationSubsystem();
+	if (!Subsystem || !GetOwner()->HasAuthority())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ReplicateActorSpawnBatch: batches are spawned by the server only"));
+		return FReplicationSpawnBatchHandle();
+	}
+
+	// The actors reach clients through their own replication, so a class that does not replicate stays on the server
+	for (const FReplicationSpawnRequest& Request : Requests)
+	{
+		if (Request.ActorClass && !Request.ActorClass->GetDefaultObject<AActor>()->GetIsReplicated())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("ReplicateActorSpawnBatch: %s does not replicate, clients will not see it"), *Request.ActorClass->GetName());
+			break;
+		}
+	}
+
+	return Subsystem->QueueSpawnBatch(this, Requests);
+}
+
 UNiagaraComponent* UNetworkReplicationComponent::ReplicateNiagaraEffect(UNiagaraSystem* Effect, FVector Location, FRotator Rotation, bool bAttachToOwner, FName AttachSocketName)
 {
 	if (!Effect)
@@ -201,7 +265,7 @@ UNiagaraComponent* UNetworkReplicationComponent::ReplicateNiagaraEffect(UNiagara
 	if (GetOwner()->HasAuthority())
 	{
 		// Server: Spawn locally and multicast to clients
-		MulticastSpawnNiagaraEffect(Effect, Location, Rotation, bAttachToOwner, AttachSocketName);
+		DispatchNiagaraEffect(Effect, Location, Rotation, bAttachToOwner, AttachSocketName);
 		return nullptr; // Will be spawned via multicast
 	}
 	else
@@ -215,37 +279,108 @@ UNiagaraComponent* UNetworkReplicationComponent::ReplicateNiagaraEffect(UNiagara
 // Server RPCs
 void UNetworkReplicationComponent::ServerPlayMontage_Implementation(UAnimMontage* Montage, float PlayRate, float StartingPosition)
 {
-	MulticastPlayMontage(Montage, PlayRate, StartingPosition);
+	if (PassesRateLimit(EReplicationRPCFamily::Animation))
+	{
+		ChargeSendBudget(ReplicationWireSize::RPCHeader + ReplicationWireSize::ObjectReference + 8);
+		MulticastPlayMontage(Montage, PlayRate, StartingPosition);
+	}
 }
 
 void UNetworkReplicationComponent::ServerStopMontage_Implementation(UAnimMontage* Montage)
 {
-	MulticastStopMontage(Montage);
+	if (PassesRateLimit(EReplicationRPCFamily::Animation))
+	{
+		ChargeSendBudget(ReplicationWireSize::RPCHeader + ReplicationWireSize::ObjectReference);
+		MulticastStopMontage(Montage);
+	}
 }
 
 void UNetworkReplicationComponent::ServerPlaySound_Implementation(USoundBase* Sound, float VolumeMultiplier, float PitchMultiplier, float StartTime)
 {
-	MulticastPlaySound(Sound, VolumeMultiplier, PitchMultiplier, StartTime);
+	if (PassesRateLimit(EReplicationRPCFamily::Sound))
+	{
+		DispatchSound(Sound, VolumeMultiplier, PitchMultiplier, StartTime);
+	}
 }
 
-void UNetworkReplicationComponent::ServerPlaySoundAtLocation_Implementation(USoundBase* Sound, FVector Location, float VolumeMultiplier, float PitchMultiplier, float StartTime)
+void UNetworkReplicationComponent::ServerPlaySoundAtLocation_Implementation(USoundBase* Sound, const FQuantizedValue& Location, float VolumeMultiplier, float PitchMultiplier, float StartTime)
 {
-	MulticastPlaySoundAtLocation(Sound, Location, VolumeMultiplier, PitchMultiplier, StartTime);
+	if (PassesRateLimit(EReplicationRPCFamily::Sound))
+	{
+		DispatchSoundAtLocation(Sound, Location, VolumeMultiplier, PitchMultiplier, StartTime);
+	}
 }
 
 void UNetworkReplicationComponent::ServerSpawnActor_Implementation(TSubclassOf<AActor> ActorClass, FVector Location, FRotator Rotation, bool bAttachToOwner)
 {
-	MulticastSpawnActor(ActorClass, Location, Rotation, bAttachToOwner);
+	if (PassesRateLimit(EReplicationRPCFamily::ActorSpawn))
+	{
+		ChargeSendBudget(ReplicationWireSize::RPCHeader + ReplicationWireSize::ObjectReference + ReplicationWireSize::Vector + ReplicationWireSize::Rotator + 1);
+		MulticastSpawnActor(ActorClass, Location, Rotation, bAttachToOwner);
+	}
 }
 
 void UNetworkReplicationComponent::ServerSpawnActorAttached_Implementation(TSubclassOf<AActor> ActorClass, FName AttachSocketName, FVector LocationOffset, FRotator RotationOffset)
 {
-	MulticastSpawnActorAttached(ActorClass, AttachSocketName, LocationOffset, RotationOffset);
+	if (PassesRateLimit(EReplicationRPCFamily::ActorSpawn))
+	{
+		ChargeSendBudget(ReplicationWireSize::RPCHeader + ReplicationWireSize::ObjectReference + FReplicatedNameId(AttachSocketName).GetEstimatedWireBytes() + ReplicationWireSize::Vector + ReplicationWireSize::Rotator);
+		MulticastSpawnActorAttached(ActorClass, AttachSocketName, LocationOffset, RotationOffset);
+	}
 }
 
 void UNetworkReplicationComponent::ServerSpawnNiagaraEffect_Implementation(UNiagaraSystem* Effect, FVector Location, FRotator Rotation, bool bAttachToOwner, FName AttachSocketName)
 {
-	MulticastSpawnNiagaraEffect(Effect, Location, Rotation, bAttachToOwner, AttachSocketName);
+	if (PassesRateLimit(EReplicationRPCFamily::NiagaraEffect))
+	{
+		DispatchNiagaraEffect(Effect, Location, Rotation, bAttachToOwner, AttachSocketName);
+	}
+}
+
+bool UNetworkReplicationComponent::PassesRateLimit(EReplicationRPCFamily Family, bool bCoalesced)
+{
+	UNetworkReplicationSubsystem* Subsystem = GetReplicationSubsystem();
+	if (!Subsystem || Subsystem->ConsumeRPCToken(GetOwner()->GetNetConnection(), Family))
+	{
+		return true;
+	}
+
+	Subsystem->RecordRateLimitedRPC(Family, bCoalesced);
+
+	if (bDebugMode)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("Rate limited %s RPC from %s"), *UEnum::GetDisplayValueAsText(Family).ToString(), *GetOwner()->GetName());
+	}
+	return false;
+}
+
+void UNetworkReplicationComponent::FlushCoalescedRPCs()
+{
+	// Apply held values in arrival order while tokens allow; anything left waits for the next tick.
+	// Each value leaves the queue before it is applied, since listeners may replicate again and change it
+	while (CoalescedVariables.Num() > 0)
+	{
+		UNetworkReplicationSubsystem* Subsystem = GetReplicationSubsystem();
+		if (Subsystem && !Subsystem->ConsumeRPCToken(GetOwner()->GetNetConnection(), EReplicationRPCFamily::Variable))
+		{
+			break;
+		}
+
+		const TPair<FName, FReplicatedVariableValue> Held = MoveTemp(CoalescedVariables[0]);
+		CoalescedVariables.RemoveAt(0);
+		ApplyPackedClientVariable(Held.Key, Held.Value);
+	}
+
+	if (bHasCoalescedTrajectory)
+	{
+		UNetworkReplicationSubsystem* Subsystem = GetReplicationSubsystem();
+		if (!Subsystem || Subsystem->ConsumeRPCToken(GetOwner()->GetNetConnection(), EReplicationRPCFamily::MotionMatching))
+		{
+			bHasCoalescedTrajectory = false;
+			ChargeSendBudget(ReplicationWireSize::RPCHeader + CoalescedTrajectoryPosition.GetEstimatedWireBytes() + CoalescedTrajectoryRotation.GetEstimatedWireBytes());
+			MulticastReplicateTrajectoryData(CoalescedTrajectoryPosition, CoalescedTrajectoryRotation);
+		}
+	}
 }
 
 // Client RPCs
@@ -268,6 +403,11 @@ void UNetworkReplicationComponent::MulticastStopMontage_Implementation(UAnimMont
 
 void UNetworkReplicationComponent::MulticastPlaySound_Implementation(USoundBase* Sound, float VolumeMultiplier, float PitchMultiplier, float StartTime)
 {
+	if (ShouldSkipCosmeticPlayback())
+	{
+		return;
+	}
+
 	if (UAudioComponent* AudioComponent = GetAudioComponent())
 	{
 		AudioComponent->SetSound(Sound);
@@ -284,12 +424,39 @@ void UNetworkReplicationComponent::MulticastPlaySound_Implementation(USoundBase*
 	}
 }
 
-void UNetworkReplicationComponent::MulticastPlaySoundAtLocation_Implementation(USoundBase* Sound, FVector Location, float VolumeMultiplier, float PitchMultiplier, float StartTime)
+void UNetworkReplicationComponent::MulticastPlaySoundAtLocation_Implementation(USoundBase* Sound, const FQuantizedValue& Location, float VolumeMultiplier, float PitchMultiplier, float StartTime)
 {
-	UGameplayStatics::PlaySoundAtLocation(GetWorld(), Sound, Location, VolumeMultiplier, PitchMultiplier, StartTime);
+	if (ShouldSkipCosmeticPlayback())
+	{
+		return;
+	}
+
+	// Without the sender's rule the location is unknown, and playing at the world origin would be worse than silence
+	FVector SoundLocation;
+	if (!DequantizeField(EReplicationQuantizedField::SoundLocation, Location, SoundLocation))
+	{
+		return;
+	}
+
+	UGameplayStatics::PlaySoundAtLocation(GetWorld(), Sound, SoundLocation, VolumeMultiplier, PitchMultiplier, StartTime);
 	OnSoundReplicated.Broadcast(Sound);
 }
 
+void UNetworkReplicationComponent::MulticastPlaySoundUnreliable_Implementation(USoundBase* Sound, float VolumeMultiplier, float PitchMultiplier, float StartTime)
+{
+	MulticastPlaySound_Implementation(Sound, VolumeMultiplier, PitchMultiplier, StartTime);
+}
+
+void UNetworkReplicationComponent::MulticastPlaySoundAtLocationUnreliable_Implementation(USoundBase* Sound, const FQuantizedValue& Location, float VolumeMultiplier, float PitchMultiplier, float StartTime)
+{
+	MulticastPlaySoundAtLocation_Implementation(Sound, Location, VolumeMultiplier, PitchMultiplier, StartTime);
+}
+
+void UNetworkReplicationComponent::MulticastSpawnNiagaraEffectUnreliable_Implementation(UNiagaraSystem* Effect, FVector Location, FRotator Rotation, bool bAttachToOwner, FName AttachSocketName)
+{
+	MulticastSpawnNiagaraEffect_Implementation(Effect, Location, Rotation, bAttachToOwner, AttachSocketName);
+}
+
 void UNetworkReplicationComponent::MulticastSpawnActor_Implementation(TSubclassOf<AActor> ActorClass, FVector Location, FRotator Rotation, bool bAttachToOwner)
 {
 	UWorld* World = GetWorld();
@@ -298,7 +465,7 @@ void UNetworkReplicationComponent::MulticastSpawnActor_Implementation(TSubclassO
 		return;
 	}
 
-	AActor* SpawnedActor = World->SpawnActor<AActor>(ActorClass, Location, Rotation);
+	AActor* SpawnedActor = SpawnReplicatedActor(ActorClass, Location, Rotation);
 	if (SpawnedActor && bAttachToOwner)
 	{
 		SpawnedActor->AttachToActor(GetOwner(), FAttachmentTransformRules::KeepWorldTransform);
@@ -321,7 +488,7 @@ void UNetworkReplicationComponent::MulticastSpawnActorAttached_Implementation(TS
 	FVector SpawnLocation = GetOwner()->GetActorLocation() + LocationOffset;
 	FRotator SpawnRotation = GetOwner()->GetActorRotation() + RotationOffset;
 
-	AActor* SpawnedActor = World->SpawnActor<AActor>(ActorClass, SpawnLocation, SpawnRotation);
+	AActor* SpawnedActor = SpawnReplicatedActor(ActorClass, SpawnLocation, SpawnRotation);
 	if (SpawnedActor)
 	{
 		// Create attachment info for hot joining support
@@ -350,18 +517,39 @@ void UNetworkReplicationComponent::MulticastSpawnActorAttached_Implementation(TS
 	}
 }
 
+AActor* UNetworkReplicationComponent::SpawnReplicatedActor(TSubclassOf<AActor> ActorClass, const FVector& Location, const FRotator& Rotation)
+{
+	UWorld* World = GetWorld();
+	UNetworkReplicationActorPool* ActorPool = bPoolSpawnedActors ? World->GetSubsystem<UNetworkReplicationActorPool>() : nullptr;
+	return ActorPool ? ActorPool->Acquire(ActorClass, Location, Rotation, this) : World->SpawnActor<AActor>(ActorClass, Location, Rotation);
+}
+
+void UNetworkReplicationComponent::OnPooledActorReleased(AActor* Actor)
+{
+	// Late joiners must not attach an actor that has gone back to the pool and may be reused elsewhere
+	if (AttachmentInfo.bIsActive && AttachmentInfo.Component && AttachmentInfo.Component->GetOwner() == Actor)
+	{
+		AttachmentInfo = FAttachmentInfo();
+		if (GetOwner() && GetOwner()->HasAuthority())
+		{
+			MarkReplicationActivity();
+		}
+	}
+}
+
 void UNetworkReplicationComponent::MulticastSpawnNiagaraEffect_Implementation(UNiagaraSystem* Effect, FVector Location, FRotator Rotation, bool bAttachToOwner, FName AttachSocketName)
 {
 	UWorld* World = GetWorld();
-	if (!World)
+	if (!World || ShouldSkipCosmeticPlayback())
 	{
 		return;
 	}
 
-		UNiagaraComponent* NiagaraComponent = NewObject<UNiagaraComponent>(World);
+	// Pooled components are already registered and go back to the pool when the system completes
+	UNetworkReplicationNiagaraPool* NiagaraPool = World->GetSubsystem<UNetworkReplicationNiagaraPool>();
+	UNiagaraComponent* NiagaraComponent = NiagaraPool ? NiagaraPool->Acquire(Effect) : nullptr;
 	if (NiagaraComponent)
 	{
-		NiagaraComponent->SetAsset(Effect);
 		NiagaraComponent->SetWorldLocationAndRotation(Location, Rotation);
 		
 		if (bAttachToOwner)
@@ -376,13 +564,54 @@ void UNetworkReplicationComponent::MulticastSpawnNiagaraEffect_Implementation(UN
 			}
 		}
 		
-		NiagaraComponent->Activate();
+		NiagaraComponent->Activate(true);
+	}
+	else if (bAttachToOwner)
+	{
+		// No pool in this world type, or none to spare, so spawn a one-off component as before pooling
+		NiagaraComponent = UNiagaraFunctionLibrary::SpawnSystemAttached(Effect, GetOwner()->GetRootComponent(), AttachSocketName, Location, Rotation, EAttachLocation::KeepWorldPosition, true);
+	}
+	else
+	{
+		NiagaraComponent = UNiagaraFunctionLibrary::SpawnSystemAtLocation(World, Effect, Location, Rotation);
+	}
+
+	if (NiagaraComponent)
+	{
 		OnNiagaraEffectReplicated.Broadcast(Effect);
 	}
 }
 
 void UNetworkReplicationComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	// Send anything still queued while the actor channel is open, budget or not.
+	// Local playback can submit more events, so send from a copy until nothing new arrives.
+	while (OutboundEvents.Num() > 0)
+	{
+		TArray<FReplicationBatchedEvent> Pending = MoveTemp(OutboundEvents);
+		OutboundEvents.Reset();
+		for (FReplicationBatchedEvent& Event : Pending)
+		{
+			SendEvent(MoveTemp(Event), EReplicationSendPriority::Critical);
+		}
+	}
+
+	if (HasPendingEventBatch())
+	{
+		FlushEventBatch();
+	}
+
+	// Stop the central tick from visiting this component
+	if (UNetworkReplicationSubsystem* Subsystem = GetReplicationSubsystem())
+	{
+		if (bOwnerAutoDormant)
+		{
+			SetOwnerAutoDormant(false);
+			Subsystem->ForgetDormantOwner();
+		}
+		Subsystem->RemoveRegisteredComponent(this);
+	}
+
 	OnComponentDestroyed.Broadcast(this);
 	Super::EndPlay(EndPlayReason);
 }
@@ -395,6 +624,8 @@ void UNetworkReplicationComponent::GetLifetimeReplicatedProps(TArray<FLifetimePr
 	DOREPLIFETIME(UNetworkReplicationComponent, AttachmentInfo);
 	DOREPLIFETIME(UNetworkReplicationComponent, PredictionState);
 	DOREPLIFETIME(UNetworkReplicationComponent, AnimationPrediction);
+	DOREPLIFETIME(UNetworkReplicationComponent, ReplicatedVariables);
+	DOREPLIFETIME(UNetworkReplicationComponent, ReplicatedState);
 }
 
 // Helper functions
@@ -417,202 +648,1539 @@ UAudioComponent* UNetworkReplicationComponent::GetAudioComponent() const
 	return GetOwner()->FindComponentByClass<UAudioComponent>();
 }
 
-// ===== NEW VARIABLE REPLICATION IMPLEMENTATIONS =====
+UNetworkReplicationSubsystem* UNetworkReplicationComponent::GetReplicationSubsystem() const
+{
+	UWorld* World = GetWorld();
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UNetworkReplicationSubsystem>() : nullptr;
+}
 
-// Variable Replication Functions
-void UNetworkReplicationComponent::ReplicateStringVariable(FName VariableName, const FString& Value)
+void UNetworkReplicationComponent::RecordReplication(EReplicationRPCFamily Family)
 {
-	if (bDebugMode)
+	const float PreviousTime = LastReplicationTime;
+	TotalReplications++;
+	LastReplicationTime = GetWorld()->GetTimeSeconds();
+
+	// Unregistered components are not part of the aggregates; their counts are added when they register
+	if (RegistryHandle.IsSet())
 	{
-		UE_LOG(LogTemp, Log, TEXT("Replicating String Variable: %s = %s"), *VariableName.ToString(), *Value);
+		if (UNetworkReplicationSubsystem* Subsystem = GetReplicationSubsystem())
+		{
+			Subsystem->RecordComponentReplication(Family, PreviousTime, LastReplicationTime);
+		}
 	}
+}
 
-	if (GetOwner()->HasAuthority())
+FReplicatedNameId UNetworkReplicationComponent::MakeNetName(FName Name) const
+{
+	if (UNetworkReplicationSubsystem* Subsystem = GetReplicationSubsystem())
 	{
-		MulticastReplicateVariable(VariableName, Value, 0); // 0 = String type
+		return Subsystem->MakeReplicatedName(GetWorld(), Name);
 	}
-	else
+	return FReplicatedNameId(Name);
+}
+
+bool UNetworkReplicationComponent::ResolveNetName(const FReplicatedNameId& NetName, FName& OutName) const
+{
+	if (!NetName.HasId())
 	{
-		ServerReplicateVariable(VariableName, Value, 0);
+		OutName = NetName.Name;
+		return true;
 	}
-	
-	TotalReplications++;
-	LastReplicationTime = GetWorld()->GetTimeSeconds();
+
+	UNetworkReplicationSubsystem* Subsystem = GetReplicationSubsystem();
+	return Subsystem && Subsystem->ResolveReplicatedName(NetName, OutName);
 }
 
-void UNetworkReplicationComponent::ReplicateFloatVariable(FName VariableName, float Value)
+bool UNetworkReplicationComponent::ResolveNetNameInOrder(const FReplicatedNameId& NetName, FName& OutName) const
 {
-	FString StringValue = FString::Printf(TEXT("%.6f"), Value);
-	
-	if (bDebugMode)
+	// Events behind a parked one wait their turn even when their own name is known
+	if (ParkedNameEvents.Num() > 0 && !bDispatchingParkedNameEvents)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Replicating Float Variable: %s = %f"), *VariableName.ToString(), Value);
+		return false;
 	}
+	return ResolveNetName(NetName, OutName);
+}
 
-	if (GetOwner()->HasAuthority())
+void UNetworkReplicationComponent::ParkUntilNameResolved(const FReplicatedNameId& NetName, TFunction<void()>&& Dispatch)
+{
+	FParkedNameEvent Parked;
+	Parked.Name = NetName;
+	Parked.ParkedTime = GetWorld()->GetTimeSeconds();
+	Parked.Dispatch = MoveTemp(Dispatch);
+
+	// Re-parked while being replayed, for a batch with a second unknown name, so it keeps its place at the front
+	if (bDispatchingParkedNameEvents)
 	{
-		MulticastReplicateVariable(VariableName, StringValue, 1); // 1 = Float type
+		ParkedNameEvents.Insert(MoveTemp(Parked), 0);
+		return;
 	}
-	else
+
+	ParkedNameEvents.Add(MoveTemp(Parked));
+	if (ParkedNameEvents.Num() == 1)
 	{
-		ServerReplicateVariable(VariableName, StringValue, 1);
+		DispatchParkedNameEvents();
 	}
-	
-	TotalReplications++;
-	LastReplicationTime = GetWorld()->GetTimeSeconds();
 }
 
-void UNetworkReplicationComponent::ReplicateIntVariable(FName VariableName, int32 Value)
+void UNetworkReplicationComponent::DispatchParkedNameEvents()
 {
-	FString StringValue = FString::Printf(TEXT("%d"), Value);
-	
-	if (bDebugMode)
+	if (bDispatchingParkedNameEvents)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Replicating Int Variable: %s = %d"), *VariableName.ToString(), Value);
+		return;
 	}
 
-	if (GetOwner()->HasAuthority())
+	UNetworkReplicationSubsystem* Subsystem = GetReplicationSubsystem();
+	while (ParkedNameEvents.Num() > 0)
 	{
-		MulticastReplicateVariable(VariableName, StringValue, 2); // 2 = Int type
+		// The dictionary entry travels on its own actor channel and can land after the RPC that uses it
+		FName ResolvedName;
+		if (!ResolveNetName(ParkedNameEvents[0].Name, ResolvedName))
+		{
+			if (Subsystem)
+			{
+				Subsystem->WaitForReplicatedName(this, ParkedNameEvents[0].Name.Id);
+			}
+			return;
+		}
+
+		TFunction<void()> Dispatch = MoveTemp(ParkedNameEvents[0].Dispatch);
+		ParkedNameEvents.RemoveAt(0, EAllowShrinking::No);
+
+		TGuardValue<bool> DispatchGuard(bDispatchingParkedNameEvents, true);
+		Dispatch();
 	}
-	else
+
+	if (Subsystem)
 	{
-		ServerReplicateVariable(VariableName, StringValue, 2);
+		Subsystem->StopWaitingForReplicatedName(this);
 	}
-	
-	TotalReplications++;
-	LastReplicationTime = GetWorld()->GetTimeSeconds();
 }
 
-void UNetworkReplicationComponent::ReplicateBoolVariable(FName VariableName, bool Value)
+void UNetworkReplicationComponent::ExpireParkedNameEvents()
 {
-	FString StringValue = Value ? TEXT("true") : TEXT("false");
-	
-	if (bDebugMode)
+	// An entry lost to a table reset or a misbehaving server must not hold back every later event
+	constexpr double ParkedNameEventTimeout = 5.0;
+	const double Now = GetWorld()->GetTimeSeconds();
+	if (Now - ParkedNameEvents[0].ParkedTime < ParkedNameEventTimeout)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Replicating Bool Variable: %s = %s"), *VariableName.ToString(), *StringValue);
+		return;
 	}
 
-	if (GetOwner()->HasAuthority())
-	{
-		MulticastReplicateVariable(VariableName, StringValue, 3); // 3 = Bool type
-	}
-	else
+	const int32 MissingId = ParkedNameEvents[0].Name.Id;
+	int32 NumExpired = 0;
+	while (ParkedNameEvents.Num() > 0 && ParkedNameEvents[0].Name.Id == MissingId && Now - ParkedNameEvents[0].ParkedTime >= ParkedNameEventTimeout)
 	{
-		ServerReplicateVariable(VariableName, StringValue, 3);
+		ParkedNameEvents.RemoveAt(0, EAllowShrinking::No);
+		NumExpired++;
 	}
-	
-	TotalReplications++;
-	LastReplicationTime = GetWorld()->GetTimeSeconds();
+
+	UE_LOG(LogTemp, Warning, TEXT("%s: dropped %d events waiting %.0f s for name id %d"), *GetNameSafe(GetOwner()), NumExpired, ParkedNameEventTimeout, MissingId);
+	DispatchParkedNameEvents();
 }
 
-void UNetworkReplicationComponent::ReplicateVectorVariable(FName VariableName, FVector Value)
+bool UNetworkReplicationComponent::QuantizeVariable(FName VariableName, FReplicatedVariableValue& InOutValue) const
 {
-	FString StringValue = Value.ToString();
-	
-	if (bDebugMode)
+	if (!QuantizationProfile)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Replicating Vector Variable: %s = %s"), *VariableName.ToString(), *StringValue);
+		return false;
 	}
 
-	if (GetOwner()->HasAuthority())
+	const FReplicationQuantizationRule* Rule = QuantizationProfile->FindVariableRule(VariableName);
+	if (!Rule)
 	{
-		MulticastReplicateVariable(VariableName, StringValue, 4); // 4 = Vector type
+		return false;
 	}
-	else
+
+	switch (InOutValue.Type)
 	{
-		ServerReplicateVariable(VariableName, StringValue, 4);
+	case EReplicatedVariableType::Float:
+		if (Rule->Quantize(FVector(InOutValue.FloatValue, 0.0, 0.0), 1, InOutValue.Quantized))
+		{
+			InOutValue.FloatValue = InOutValue.Quantized.Value.X;
+			return true;
+		}
+		return false;
+	case EReplicatedVariableType::Vector:
+		if (Rule->Quantize(InOutValue.VectorValue, 3, InOutValue.Quantized))
+		{
+			InOutValue.VectorValue = InOutValue.Quantized.Value;
+			return true;
+		}
+		return false;
+	default:
+		return false;
 	}
-	
-	TotalReplications++;
-	LastReplicationTime = GetWorld()->GetTimeSeconds();
 }
 
-// Custom Event Replication
-void UNetworkReplicationComponent::ReplicateCustomEvent(FName EventName, const FString& EventData)
+bool UNetworkReplicationComponent::DequantizeVariable(FName VariableName, FReplicatedVariableValue& InOutValue) const
 {
-	if (bDebugMode)
+	if (!InOutValue.Quantized.IsQuantized())
 	{
-		UE_LOG(LogTemp, Log, TEXT("Replicating Custom Event: %s with data: %s"), *EventName.ToString(), *EventData);
+		return true;
 	}
 
-	if (GetOwner()->HasAuthority())
+	const FReplicationQuantizationRule* Rule = QuantizationProfile ? QuantizationProfile->FindVariableRule(VariableName) : nullptr;
+	if (!Rule || Rule->Mode != InOutValue.Quantized.Mode)
+	{
+		// Once per name, since every update would repeat it
+		if (ShouldWarnUndecodableVariable(VariableName))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("DequantizeVariable: No matching quantization rule for %s, check QuantizationProfile matches the sender. Values for it are skipped"), *VariableName.ToString());
+		}
+		return false;
+	}
+
+	InOutValue.Quantized.Value = Rule->Dequantize(InOutValue.Quantized);
+	if (InOutValue.Type == EReplicatedVariableType::Float)
 	{
-		MulticastReplicateCustomEvent(EventName, EventData);
+		InOutValue.FloatValue = InOutValue.Quantized.Value.X;
 	}
-	else
+	else if (InOutValue.Type == EReplicatedVariableType::Vector)
 	{
-		ServerReplicateCustomEvent(EventName, EventData);
+		InOutValue.VectorValue = InOutValue.Quantized.Value;
 	}
-	
-	TotalReplications++;
-	LastReplicationTime = GetWorld()->GetTimeSeconds();
+	return true;
 }
 
-// Debugging Functions
-void UNetworkReplicationComponent::EnableDebugLogging(bool bEnabled)
+namespace NetworkReplicationQuantization
 {
-	bDebugMode = bEnabled;
-	
-	if (bDebugMode)
-	{
-		UE_LOG(LogTemp, Log, TEXT("NetworkReplicationComponent: Debug mode enabled"));
-	}
-	else
+	/** 16 bits per axis, the same axis packing as FRotator::SerializeCompressedShort */
+	static const FReplicationQuantizationRule& GetCompressedShortAngleRule()
 	{
-		UE_LOG(LogTemp, Log, TEXT("NetworkReplicationComponent: Debug mode disabled"));
+		static const FReplicationQuantizationRule Rule = []()
+		{
+			FReplicationQuantizationRule AngleRule;
+			AngleRule.Mode = EReplicationQuantizationMode::Angle;
+			AngleRule.BitsPerComponent = 16;
+			return AngleRule;
+		}();
+		return Rule;
 	}
 }
 
-void UNetworkReplicationComponent::LogReplicationEvent(const FString& EventName)
+FQuantizedValue UNetworkReplicationComponent::QuantizeField(EReplicationQuantizedField Field, const FVector& Value, int32 NumComponents) const
 {
-	if (bDebugMode)
+	FQuantizedValue Result;
+	Result.Value = Value;
+
+	const FReplicationQuantizationRule* Rule = QuantizationProfile ? QuantizationProfile->FindEventRule(Field) : nullptr;
+	if (Rule)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Replication Event: %s"), *EventName);
+		Rule->Quantize(Value, NumComponents, Result);
+	}
+	else if (Field == EReplicationQuantizedField::TrajectoryRotation)
+	{
+		// Raw floats would cost 96 bits where an FRotator parameter cost at most 48
+		NetworkReplicationQuantization::GetCompressedShortAngleRule().Quantize(Value, NumComponents, Result);
 	}
+	return Result;
 }
 
-FString UNetworkReplicationComponent::GetReplicationStats() const
+bool UNetworkReplicationComponent::DequantizeField(EReplicationQuantizedField Field, const FQuantizedValue& Value, FVector& OutValue) const
 {
-	return FString::Printf(TEXT("Total Replications: %d, Last: %.2f"), 
-		TotalReplications, LastReplicationTime);
+	if (!Value.IsQuantized())
+	{
+		OutValue = Value.Value;
+		return true;
+	}
+
+	const FReplicationQuantizationRule* Rule = QuantizationProfile ? QuantizationProfile->FindEventRule(Field) : nullptr;
+	if (Rule && Rule->Mode == Value.Mode)
+	{
+		OutValue = Rule->Dequantize(Value);
+		return true;
+	}
+
+	// Angles decode from the bit width on the wire alone, which also covers the built-in rotation fallback
+	if (Value.Mode == EReplicationQuantizationMode::Angle)
+	{
+		OutValue = NetworkReplicationQuantization::GetCompressedShortAngleRule().Dequantize(Value);
+		return true;
+	}
+
+	// Once per field, since every event would repeat it
+	if (ShouldWarnUndecodableField(Field))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DequantizeField: No matching quantization rule for field %d, check QuantizationProfile matches the sender. Values for it are skipped"), static_cast<int32>(Field));
+	}
+	return false;
 }
 
-// Server RPC Implementations
-void UNetworkReplicationComponent::ServerReplicateVariable_Implementation(FName VariableName, const FString& Value, int32 VariableType)
+bool UNetworkReplicationComponent::ShouldWarnUndecodableVariable(FName VariableName) const
 {
-	MulticastReplicateVariable(VariableName, Value, VariableType);
+	ResetUndecodableWarningsOnProfileChange();
+
+	bool bAlreadyWarned = false;
+	UndecodableVariables.Add(VariableName, &bAlreadyWarned);
+	return !bAlreadyWarned;
 }
 
-void UNetworkReplicationComponent::ServerReplicateCustomEvent_Implementation(FName EventName, const FString& EventData)
+bool UNetworkReplicationComponent::ShouldWarnUndecodableField(EReplicationQuantizedField Field) const
 {
-	MulticastReplicateCustomEvent(EventName, EventData);
+	ResetUndecodableWarningsOnProfileChange();
+
+	const uint32 FieldBit = 1u << static_cast<uint32>(Field);
+	const bool bAlreadyWarned = (UndecodableFields & FieldBit) != 0;
+	UndecodableFields |= FieldBit;
+	return !bAlreadyWarned;
 }
 
-// Client RPC Implementations
-void UNetworkReplicationComponent::MulticastReplicateVariable_Implementation(FName VariableName, const FString& Value, int32 VariableType)
+void UNetworkReplicationComponent::ResetUndecodableWarningsOnProfileChange() const
 {
-	OnVariableReplicated.Broadcast(VariableName, Value);
-	
-	if (bDebugMode)
+	// A new profile may decode what the old one could not, so it starts with a clean slate
+	if (UndecodableWarningsProfile.Get() != QuantizationProfile.Get())
 	{
-		UE_LOG(LogTemp, Log, TEXT("Variable Replicated: %s = %s (Type: %d)"), 
-			*VariableName.ToString(), *Value, VariableType);
+		UndecodableVariables.Reset();
+		UndecodableFields = 0;
+		UndecodableWarningsProfile = QuantizationProfile.Get();
 	}
 }
 
-void UNetworkReplicationComponent::MulticastReplicateCustomEvent_Implementation(FName EventName, const FString& EventData)
+void UNetworkReplicationComponent::BroadcastVariableValue(FName VariableName, const FReplicatedVariableValue& Value)
 {
-	OnCustomEventReplicated.Broadcast(EventName, EventData);
-	
-	if (bDebugMode)
+	switch (Value.Type)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Custom Event Replicated: %s with data: %s"), 
-			*EventName.ToString(), *EventData);
+	case EReplicatedVariableType::Float:
+		OnFloatVariableReplicated.Broadcast(VariableName, Value.FloatValue);
+		break;
+	case EReplicatedVariableType::Int:
+		OnIntVariableReplicated.Broadcast(VariableName, Value.IntValue);
+		break;
+	case EReplicatedVariableType::Bool:
+		OnBoolVariableReplicated.Broadcast(VariableName, Value.BoolValue);
+		break;
+	case EReplicatedVariableType::Vector:
+		OnVectorVariableReplicated.Broadcast(VariableName, Value.VectorValue);
+		break;
+	default:
+		break;
 	}
-}
 
-// ===== MOTION MATCHING IMPLEMENTATIONS =====
+	OnVariableValueReplicatedNative.Broadcast(VariableName, Value);
+
+	// The string delegate needs text formatting, so only pay for it when someone listens
+	if (OnVariableReplicated.IsBound())
+	{
+		OnVariableReplicated.Broadcast(VariableName, Value.ToString());
+	}
+}
+
+// ===== NEW VARIABLE REPLICATION IMPLEMENTATIONS =====
+
+// Variable Replication Functions
+void UNetworkReplicationComponent::ReplicateStringVariable(FName VariableName, const FString& Value)
+{
+	ReplicateVariableValue(VariableName, FReplicatedVariableValue::MakeString(Value));
+}
+
+void UNetworkReplicationComponent::ReplicateFloatVariable(FName VariableName, float Value)
+{
+	ReplicateVariableValue(VariableName, FReplicatedVariableValue::MakeFloat(Value));
+}
+
+void UNetworkReplicationComponent::ReplicateIntVariable(FName VariableName, int32 Value)
+{
+	ReplicateVariableValue(VariableName, FReplicatedVariableValue::MakeInt(Value));
+}
+
+void UNetworkReplicationComponent::ReplicateBoolVariable(FName VariableName, bool Value)
+{
+	ReplicateVariableValue(VariableName, FReplicatedVariableValue::MakeBool(Value));
+}
+
+void UNetworkReplicationComponent::ReplicateVectorVariable(FName VariableName, FVector Value)
+{
+	ReplicateVariableValue(VariableName, FReplicatedVariableValue::MakeVector(Value));
+}
+
+void UNetworkReplicationComponent::ReplicateVariableValue(FName VariableName, const FReplicatedVariableValue& Value)
+{
+	// Quantize first so change detection compares the values receivers will actually decode
+	if (!Value.Quantized.IsQuantized())
+	{
+		FReplicatedVariableValue QuantizedValue = Value;
+		if (QuantizeVariable(VariableName, QuantizedValue))
+		{
+			ReplicateVariableValue(VariableName, QuantizedValue);
+			return;
+		}
+	}
+
+	const FReplicatedVariableThreshold* Threshold = VariableThresholds.Find(VariableName);
+	if (!Threshold)
+	{
+		Threshold = &DefaultVariableThreshold;
+	}
+
+	if (FVariableSendState* State = VariableSendStates.Find(VariableName))
+	{
+		if (Threshold->IsUnchanged(State->LastSentValue, Value))
+		{
+			// Back within tolerance of what receivers already have, so any held value is obsolete
+			if (State->bHasPendingValue)
+			{
+				State->bHasPendingValue = false;
+				NumPendingVariables--;
+			}
+			SuppressedReplications++;
+			return;
+		}
+
+		if (GetWorld()->GetTimeSeconds() - State->LastSendTime < Threshold->MinResendInterval)
+		{
+			if (!State->bHasPendingValue)
+			{
+				State->bHasPendingValue = true;
+				NumPendingVariables++;
+			}
+			State->PendingValue = Value;
+			SuppressedReplications++;
+			return;
+		}
+	}
+
+	SendVariableValue(VariableName, Value);
+}
+
+void UNetworkReplicationComponent::SendVariableValue(FName VariableName, const FReplicatedVariableValue& Value)
+{
+	FVariableSendState& State = VariableSendStates.FindOrAdd(VariableName);
+	State.LastSentValue = Value;
+	State.LastSendTime = GetWorld()->GetTimeSeconds();
+	if (State.bHasPendingValue)
+	{
+		State.bHasPendingValue = false;
+		NumPendingVariables--;
+	}
+
+	if (bDebugMode)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Replicating %s Variable: %s = %s"),
+			*UEnum::GetDisplayValueAsText(Value.Type).ToString(), *VariableName.ToString(), *Value.ToString());
+	}
+
+	if (GetOwner()->HasAuthority())
+	{
+		if (bPersistentVariables)
+		{
+			StoreVariableValue(VariableName, Value);
+		}
+		else
+		{
+			DispatchVariable(VariableName, Value);
+		}
+	}
+	else
+	{
+		ServerReplicateVariable(MakeNetName(VariableName), Value);
+	}
+	
+	RecordReplication(EReplicationRPCFamily::Variable);
+}
+
+void UNetworkReplicationComponent::FlushPendingVariables()
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	// Collect first, sending can add send states and invalidate the map iterator
+	TArray<TPair<FName, FReplicatedVariableValue>> DueValues;
+	for (const TPair<FName, FVariableSendState>& Pair : VariableSendStates)
+	{
+		const FVariableSendState& State = Pair.Value;
+		if (!State.bHasPendingValue)
+		{
+			continue;
+		}
+
+		const FReplicatedVariableThreshold* Threshold = VariableThresholds.Find(Pair.Key);
+		const float MinResendInterval = Threshold ? Threshold->MinResendInterval : DefaultVariableThreshold.MinResendInterval;
+		if (Now - State.LastSendTime >= MinResendInterval)
+		{
+			DueValues.Emplace(Pair.Key, State.PendingValue);
+		}
+	}
+
+	for (const TPair<FName, FReplicatedVariableValue>& Due : DueValues)
+	{
+		SendVariableValue(Due.Key, Due.Value);
+	}
+}
+
+// Persistent Variable Access
+bool UNetworkReplicationComponent::GetReplicatedVariable(FName VariableName, FReplicatedVariableValue& OutValue) const
+{
+	if (const FReplicatedVariableValue* Value = ReplicatedVariables.FindValue(VariableName))
+	{
+		OutValue = *Value;
+		return true;
+	}
+	return false;
+}
+
+FString UNetworkReplicationComponent::GetStringVariable(FName VariableName, const FString& DefaultValue) const
+{
+	const FReplicatedVariableValue* Value = ReplicatedVariables.FindValue(VariableName);
+	return Value && Value->Type == EReplicatedVariableType::String ? Value->StringValue : DefaultValue;
+}
+
+float UNetworkReplicationComponent::GetFloatVariable(FName VariableName, float DefaultValue) const
+{
+	const FReplicatedVariableValue* Value = ReplicatedVariables.FindValue(VariableName);
+	return Value && Value->Type == EReplicatedVariableType::Float ? Value->FloatValue : DefaultValue;
+}
+
+int32 UNetworkReplicationComponent::GetIntVariable(FName VariableName, int32 DefaultValue) const
+{
+	const FReplicatedVariableValue* Value = ReplicatedVariables.FindValue(VariableName);
+	return Value && Value->Type == EReplicatedVariableType::Int ? Value->IntValue : DefaultValue;
+}
+
+bool UNetworkReplicationComponent::GetBoolVariable(FName VariableName, bool DefaultValue) const
+{
+	const FReplicatedVariableValue* Value = ReplicatedVariables.FindValue(VariableName);
+	return Value && Value->Type == EReplicatedVariableType::Bool ? Value->BoolValue : DefaultValue;
+}
+
+FVector UNetworkReplicationComponent::GetVectorVariable(FName VariableName, FVector DefaultValue) const
+{
+	const FReplicatedVariableValue* Value = ReplicatedVariables.FindValue(VariableName);
+	return Value && Value->Type == EReplicatedVariableType::Vector ? Value->VectorValue : DefaultValue;
+}
+
+void UNetworkReplicationComponent::StoreVariableValue(FName VariableName, const FReplicatedVariableValue& Value)
+{
+	// Clients are notified through the store's item callbacks; the server broadcasts locally
+	if (ReplicatedVariables.SetValue(VariableName, Value))
+	{
+		// Store entries go out as property deltas on the next net update; charge them like any other send
+		ChargeSendBudget(ReplicationWireSize::RPCHeader + FReplicatedNameId(VariableName).GetEstimatedWireBytes() + Value.GetEstimatedWireBytes());
+		BroadcastVariableValue(VariableName, Value);
+	}
+}
+
+// ===== LATEST-WINS STATE IMPLEMENTATIONS =====
+
+void UNetworkReplicationComponent::ReplicateFloatState(FName Key, float Value)
+{
+	ReplicateStateValue(Key, FReplicatedVariableValue::MakeFloat(Value));
+}
+
+void UNetworkReplicationComponent::ReplicateIntState(FName Key, int32 Value)
+{
+	ReplicateStateValue(Key, FReplicatedVariableValue::MakeInt(Value));
+}
+
+void UNetworkReplicationComponent::ReplicateBoolState(FName Key, bool Value)
+{
+	ReplicateStateValue(Key, FReplicatedVariableValue::MakeBool(Value));
+}
+
+void UNetworkReplicationComponent::ReplicateVectorState(FName Key, FVector Value)
+{
+	ReplicateStateValue(Key, FReplicatedVariableValue::MakeVector(Value));
+}
+
+void UNetworkReplicationComponent::ReplicateStateValue(FName Key, const FReplicatedVariableValue& Value)
+{
+	FReplicatedVariableValue NetValue = Value;
+	QuantizeVariable(Key, NetValue);
+
+	if (GetOwner()->HasAuthority())
+	{
+		// Clients are notified through the store's item callbacks; the server broadcasts locally
+		if (!ReplicatedState.SetValue(Key, NetValue))
+		{
+			return;
+		}
+		ChargeSendBudget(ReplicationWireSize::RPCHeader + FReplicatedNameId(Key).GetEstimatedWireBytes() + NetValue.GetEstimatedWireBytes());
+		OnStateReplicated.Broadcast(Key, NetValue);
+	}
+	else
+	{
+		FStateSendState* State = OutgoingStates.Find(Key);
+		if (State && !State->bServerOverridden && State->Value.Equals(NetValue))
+		{
+			// Already sent; an unacknowledged copy is picked up by the resend pass
+			return;
+		}
+
+		if (!State)
+		{
+			State = &OutgoingStates.Add(Key);
+		}
+
+		if (State->bAcked)
+		{
+			NumUnackedStates++;
+		}
+
+		// Overwriting the value supersedes anything still in flight for this key
+		State->Value = NetValue;
+		// Zero marks server writes in the replicated store, so it is never used as a client sequence
+		State->Sequence = State->Sequence == MAX_uint16 ? 1 : State->Sequence + 1;
+		State->bAcked = false;
+		State->bServerOverridden = false;
+		SendStateValue(Key, *State);
+	}
+
+	RecordReplication(EReplicationRPCFamily::State);
+}
+
+bool UNetworkReplicationComponent::GetReplicatedState(FName Key, FReplicatedVariableValue& OutValue) const
+{
+	const FStateSendState* State = OutgoingStates.Find(Key);
+	if (State && !State->bServerOverridden)
+	{
+		OutValue = State->Value;
+		return true;
+	}
+
+	if (const FReplicatedVariableValue* Value = ReplicatedState.FindValue(Key))
+	{
+		OutValue = *Value;
+		return true;
+	}
+	return false;
+}
+
+void UNetworkReplicationComponent::SendStateValue(FName Key, FStateSendState& State)
+{
+	State.LastSendTime = GetWorld()->GetTimeSeconds();
+	ServerUpdateState(MakeNetName(Key), State.Value, State.Sequence);
+}
+
+void UNetworkReplicationComponent::ResendUnackedStates()
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	for (TPair<FName, FStateSendState>& Pair : OutgoingStates)
+	{
+		FStateSendState& State = Pair.Value;
+		if (!State.bAcked && Now - State.LastSendTime >= StateResendInterval)
+		{
+			SendStateValue(Pair.Key, State);
+			StateResends++;
+		}
+	}
+}
+
+void UNetworkReplicationComponent::HandleStoreItemReplicated(const FReplicatedVariableArray& Store, FName Key, FReplicatedVariableValue& Value, uint16 SourceSequence)
+{
+	if (!DequantizeVariable(Key, Value))
+	{
+		return;
+	}
+
+	if (&Store != &ReplicatedState)
+	{
+		BroadcastVariableValue(Key, Value);
+		return;
+	}
+
+	// Echoes of this client's own writes, the latest or one a newer write supersedes, carry nothing it does not know
+	FStateSendState* State = OutgoingStates.Find(Key);
+	if (State && SourceSequence != 0 && static_cast<int16>(SourceSequence - State->Sequence) <= 0)
+	{
+		return;
+	}
+
+	// The server corrected or overrode the key, so its value stands until this client writes again
+	if (State)
+	{
+		State->bServerOverridden = true;
+	}
+	OnStateReplicated.Broadcast(Key, Value);
+}
+
+void UNetworkReplicationComponent::ServerUpdateState_Implementation(const FReplicatedNameId& NetKey, const FReplicatedVariableValue& Value, uint16 Sequence)
+{
+	// Leaving it unacknowledged makes the client resend only its newest value later
+	if (!PassesRateLimit(EReplicationRPCFamily::State, true))
+	{
+		return;
+	}
+
+	FName Key;
+	if (!ResolveNetName(NetKey, Key))
+	{
+		WarnUnknownClientName(TEXT("ServerUpdateState"), NetKey);
+		return;
+	}
+
+	if (const uint16* LastSequence = ReceivedStateSequences.Find(Key))
+	{
+		// Wrapping compare, anything not strictly newer is a duplicate or arrived out of order.
+		// Acknowledge it anyway, otherwise a lost ack keeps the client resending
+		if (static_cast<int16>(Sequence - *LastSequence) <= 0)
+		{
+			ClientAckState(NetKey, Sequence);
+			return;
+		}
+	}
+
+	// Unacknowledged, the client keeps resending, so the value is not lost if the profile is fixed
+	FReplicatedVariableValue DecodedValue = Value;
+	if (!DequantizeVariable(Key, DecodedValue))
+	{
+		return;
+	}
+
+	ReceivedStateSequences.Add(Key, Sequence);
+	if (ReplicatedState.SetValue(Key, DecodedValue, Sequence))
+	{
+		ChargeSendBudget(ReplicationWireSize::RPCHeader + FReplicatedNameId(Key).GetEstimatedWireBytes() + Value.GetEstimatedWireBytes());
+		OnStateReplicated.Broadcast(Key, DecodedValue);
+	}
+	ClientAckState(NetKey, Sequence);
+}
+
+void UNetworkReplicationComponent::ClientAckState_Implementation(const FReplicatedNameId& NetKey, uint16 Sequence)
+{
+	FName Key;
+	if (!ResolveNetName(NetKey, Key))
+	{
+		// The resend pass retries, and a later ack will resolve
+		return;
+	}
+
+	FStateSendState* State = OutgoingStates.Find(Key);
+	if (State && !State->bAcked && State->Sequence == Sequence)
+	{
+		State->bAcked = true;
+		NumUnackedStates--;
+	}
+}
+
+// Custom Event Replication
+void UNetworkReplicationComponent::ReplicateCustomEvent(FName EventName, const FString& EventData)
+{
+	if (bDebugMode)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Replicating Custom Event: %s with data: %s"), *EventName.ToString(), *EventData);
+	}
+
+	if (GetOwner()->HasAuthority())
+	{
+		DispatchCustomEvent(EventName, EventData);
+	}
+	else
+	{
+		ServerReplicateCustomEvent(MakeNetName(EventName), EventData);
+	}
+	
+	RecordReplication(EReplicationRPCFamily::CustomEvent);
+}
+
+void UNetworkReplicationComponent::ReplicateStructEvent(FName EventName, const FInstancedStruct& Payload)
+{
+	if (!Payload.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ReplicateStructEvent: Payload is empty"));
+		return;
+	}
+
+	if (bDebugMode)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Replicating Struct Event: %s with payload: %s"), *EventName.ToString(), *Payload.GetScriptStruct()->GetName());
+	}
+
+	if (GetOwner()->HasAuthority())
+	{
+		DispatchStructEvent(EventName, Payload);
+	}
+	else
+	{
+		ServerReplicateStructEvent(MakeNetName(EventName), Payload);
+	}
+	
+	RecordReplication(EReplicationRPCFamily::CustomEvent);
+}
+
+// Debugging Functions
+void UNetworkReplicationComponent::EnableDebugLogging(bool bEnabled)
+{
+	bDebugMode = bEnabled;
+	
+	if (bDebugMode)
+	{
+		UE_LOG(LogTemp, Log, TEXT("NetworkReplicationComponent: Debug mode enabled"));
+	}
+	else
+	{
+		UE_LOG(LogTemp, Log, TEXT("NetworkReplicationComponent: Debug mode disabled"));
+	}
+}
+
+void UNetworkReplicationComponent::LogReplicationEvent(const FString& EventName)
+{
+	if (bDebugMode)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Replication Event: %s"), *EventName);
+	}
+}
+
+FString UNetworkReplicationComponent::GetReplicationStats() const
+{
+	return FString::Printf(TEXT("Total Replications: %d, Suppressed: %d, State Resends: %d, Last: %.2f"), 
+		TotalReplications, SuppressedReplications, StateResends, LastReplicationTime);
+}
+
+// Server RPC Implementations
+void UNetworkReplicationComponent::ServerReplicateVariable_Implementation(const FReplicatedNameId& NetVariableName, const FReplicatedVariableValue& Value)
+{
+	// Known names are rate limited below, where a held-back value can be coalesced under its name
+	FName VariableName;
+	if (!ResolveNetName(NetVariableName, VariableName))
+	{
+		if (PassesRateLimit(EReplicationRPCFamily::Variable))
+		{
+			WarnUnknownClientName(TEXT("ServerReplicateVariable"), NetVariableName);
+		}
+		return;
+	}
+
+	// A held older value must not overwrite this one later, and the newest moves to the back of the arrival order
+	CoalescedVariables.RemoveAll([VariableName](const TPair<FName, FReplicatedVariableValue>& Held) { return Held.Key == VariableName; });
+
+	if (!PassesRateLimit(EReplicationRPCFamily::Variable, true))
+	{
+		// Only the newest value matters, so hold it packed and decode it once the connection has tokens again
+		CoalescedVariables.Emplace(VariableName, Value);
+		return;
+	}
+
+	ApplyPackedClientVariable(VariableName, Value);
+}
+
+void UNetworkReplicationComponent::ApplyPackedClientVariable(FName VariableName, const FReplicatedVariableValue& Value)
+{
+	// Decode for the server's own listeners; the packed form is kept and forwarded as-is
+	FReplicatedVariableValue DecodedValue = Value;
+	if (DequantizeVariable(VariableName, DecodedValue))
+	{
+		ApplyClientVariable(VariableName, DecodedValue);
+	}
+}
+
+void UNetworkReplicationComponent::WarnUnknownClientName(const TCHAR* RPCName, const FReplicatedNameId& NetName) const
+{
+	// The server assigned every id, so an unknown one comes from a misbehaving client that could otherwise flood the log
+	UNetworkReplicationSubsystem* Subsystem = GetReplicationSubsystem();
+	if (!Subsystem || Subsystem->ShouldWarnUnknownName(GetOwner()->GetNetConnection()))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s: Unknown name id %d from %s. Further unknown ids from this connection are logged at Verbose"), RPCName, NetName.Id, *GetNameSafe(GetOwner()));
+	}
+	else
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("%s: Unknown name id %d from %s"), RPCName, NetName.Id, *GetNameSafe(GetOwner()));
+	}
+}
+
+void UNetworkReplicationComponent::ApplyClientVariable(FName VariableName, const FReplicatedVariableValue& Value)
+{
+	if (bPersistentVariables)
+	{
+		StoreVariableValue(VariableName, Value);
+	}
+	else
+	{
+		DispatchVariable(VariableName, Value);
+	}
+}
+
+void UNetworkReplicationComponent::ServerReplicateCustomEvent_Implementation(const FReplicatedNameId& NetEventName, const FReplicationCompressedString& EventData)
+{
+	if (!PassesRateLimit(EReplicationRPCFamily::CustomEvent))
+	{
+		return;
+	}
+
+	FName EventName;
+	if (!ResolveNetName(NetEventName, EventName))
+	{
+		WarnUnknownClientName(TEXT("ServerReplicateCustomEvent"), NetEventName);
+		return;
+	}
+
+	DispatchCustomEvent(EventName, EventData.Value);
+}
+
+void UNetworkReplicationComponent::ServerReplicateStructEvent_Implementation(const FReplicatedNameId& NetEventName, const FInstancedStruct& Payload)
+{
+	if (!PassesRateLimit(EReplicationRPCFamily::CustomEvent))
+	{
+		return;
+	}
+
+	FName EventName;
+	if (!ResolveNetName(NetEventName, EventName))
+	{
+		WarnUnknownClientName(TEXT("ServerReplicateStructEvent"), NetEventName);
+		return;
+	}
+
+	if (!Payload.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ServerReplicateStructEvent: Empty payload for %s"), *EventName.ToString());
+		return;
+	}
+
+	DispatchStructEvent(EventName, Payload);
+}
+
+// Client RPC Implementations
+void UNetworkReplicationComponent::MulticastReplicateVariable_Implementation(const FReplicatedNameId& NetVariableName, const FReplicatedVariableValue& Value)
+{
+	FName VariableName;
+	if (!ResolveNetNameInOrder(NetVariableName, VariableName))
+	{
+		ParkUntilNameResolved(NetVariableName, [this, NetVariableName, Value]() { MulticastReplicateVariable_Implementation(NetVariableName, Value); });
+		return;
+	}
+
+	FReplicatedVariableValue DecodedValue = Value;
+	if (!DequantizeVariable(VariableName, DecodedValue))
+	{
+		return;
+	}
+	BroadcastVariableValue(VariableName, DecodedValue);
+	
+	if (bDebugMode)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Variable Replicated: %s = %s (Type: %d)"), 
+			*VariableName.ToString(), *DecodedValue.ToString(), static_cast<int32>(DecodedValue.Type));
+	}
+}
+
+void UNetworkReplicationComponent::MulticastReplicateCustomEvent_Implementation(const FReplicatedNameId& NetEventName, const FReplicationCompressedString& EventData)
+{
+	FName EventName;
+	if (!ResolveNetNameInOrder(NetEventName, EventName))
+	{
+		ParkUntilNameResolved(NetEventName, [this, NetEventName, EventData]() { MulticastReplicateCustomEvent_Implementation(NetEventName, EventData); });
+		return;
+	}
+
+	OnCustomEventReplicated.Broadcast(EventName, EventData.Value);
+	
+	if (bDebugMode)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Custom Event Replicated: %s with data: %s"), 
+			*EventName.ToString(), *EventData.Value);
+	}
+}
+
+void UNetworkReplicationComponent::MulticastReplicateStructEvent_Implementation(const FReplicatedNameId& NetEventName, const FInstancedStruct& Payload)
+{
+	FName EventName;
+	if (!ResolveNetNameInOrder(NetEventName, EventName))
+	{
+		ParkUntilNameResolved(NetEventName, [this, NetEventName, Payload]() { MulticastReplicateStructEvent_Implementation(NetEventName, Payload); });
+		return;
+	}
+
+	OnStructEventReplicatedNative.Broadcast(EventName, Payload);
+	OnStructEventReplicated.Broadcast(EventName, Payload);
+	
+	if (bDebugMode)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Struct Event Replicated: %s with payload: %s"), 
+			*EventName.ToString(), Payload.IsValid() ? *Payload.GetScriptStruct()->GetName() : TEXT("None"));
+	}
+}
+
+// ===== EVENT BATCHING IMPLEMENTATIONS =====
+
+void UNetworkReplicationComponent::DispatchSound(USoundBase* Sound, float VolumeMultiplier, float PitchMultiplier, float StartTime)
+{
+	FReplicationBatchedEvent Event;
+	Event.Type = EReplicationEventType::Sound;
+	Event.Asset = Sound;
+	Event.VolumeMultiplier = VolumeMultiplier;
+	Event.PitchMultiplier = PitchMultiplier;
+	Event.StartTime = StartTime;
+	SubmitEvent(MoveTemp(Event));
+}
+
+void UNetworkReplicationComponent::DispatchSoundAtLocation(USoundBase* Sound, const FQuantizedValue& Location, float VolumeMultiplier, float PitchMultiplier, float StartTime)
+{
+	FReplicationBatchedEvent Event;
+	Event.Type = EReplicationEventType::SoundAtLocation;
+	Event.Asset = Sound;
+	Event.QuantizedLocation = Location;
+	Event.VolumeMultiplier = VolumeMultiplier;
+	Event.PitchMultiplier = PitchMultiplier;
+	Event.StartTime = StartTime;
+	SubmitEvent(MoveTemp(Event));
+}
+
+void UNetworkReplicationComponent::DispatchNiagaraEffect(UNiagaraSystem* Effect, const FVector& Location, const FRotator& Rotation, bool bAttachToOwner, FName AttachSocketName)
+{
+	FReplicationBatchedEvent Event;
+	Event.Type = EReplicationEventType::NiagaraEffect;
+	Event.Asset = Effect;
+	Event.Location = Location;
+	Event.Rotation = Rotation;
+	Event.bAttachToOwner = bAttachToOwner;
+	Event.Name = MakeNetName(AttachSocketName);
+	SubmitEvent(MoveTemp(Event));
+}
+
+void UNetworkReplicationComponent::DispatchVariable(FName VariableName, const FReplicatedVariableValue& Value)
+{
+	FReplicationBatchedEvent Event;
+	Event.Type = EReplicationEventType::Variable;
+	Event.Name = MakeNetName(VariableName);
+	Event.Value = Value;
+	SubmitEvent(MoveTemp(Event));
+}
+
+void UNetworkReplicationComponent::DispatchCustomEvent(FName EventName, const FString& EventData)
+{
+	FReplicationBatchedEvent Event;
+	Event.Type = EReplicationEventType::CustomEvent;
+	Event.Name = MakeNetName(EventName);
+	Event.Data = EventData;
+	SubmitEvent(MoveTemp(Event));
+}
+
+void UNetworkReplicationComponent::DispatchStructEvent(FName EventName, const FInstancedStruct& Payload)
+{
+	FReplicationBatchedEvent Event;
+	Event.Type = EReplicationEventType::StructEvent;
+	Event.Name = MakeNetName(EventName);
+	Event.Payload = Payload;
+	SubmitEvent(MoveTemp(Event));
+}
+
+// ===== SEND BUDGET IMPLEMENTATIONS =====
+
+void UNetworkReplicationComponent::SubmitEvent(FReplicationBatchedEvent&& Event)
+{
+	UNetworkReplicationSubsystem* Subsystem = GetReplicationSubsystem();
+	if (!Subsystem || GetNetMode() == NM_Standalone)
+	{
+		SendEvent(MoveTemp(Event), EReplicationSendPriority::Critical);
+		return;
+	}
+
+	if (OutboundEvents.Num() >= MaxOutboundEvents)
+	{
+		// Make room by dropping the oldest queued cosmetic; a cosmetic that finds none is dropped itself
+		const int32 CosmeticIndex = Event.GetSendPriority() == EReplicationSendPriority::Low ? INDEX_NONE : OutboundEvents.IndexOfByPredicate([](const FReplicationBatchedEvent& Queued)
+		{
+			return Queued.GetSendPriority() == EReplicationSendPriority::Low;
+		});
+
+		if (CosmeticIndex == INDEX_NONE)
+		{
+			UE_CLOG(Event.GetSendPriority() != EReplicationSendPriority::Low, LogTemp, Warning, TEXT("%s: send queue full (%d events), dropping %s event"),
+				*GetNameSafe(GetOwner()), OutboundEvents.Num(), *UEnum::GetDisplayValueAsText(Event.Type).ToString());
+			Subsystem->RecordBudgetedBytes(Event.GetEstimatedWireBytes(), true);
+			return;
+		}
+
+		Subsystem->RecordBudgetedBytes(OutboundEvents[CosmeticIndex].GetEstimatedWireBytes(), true);
+		OutboundEvents.RemoveAt(CosmeticIndex, 1, EAllowShrinking::No);
+	}
+
+	// The owner must be awake by the time the scheduler sends this
+	MarkReplicationActivity();
+
+	// The subsystem decides when this component gets to send, based on its priority and how long it has waited
+	Event.QueuedTime = GetWorld()->GetTimeSeconds();
+	OutboundEvents.Add(MoveTemp(Event));
+	if (OutboundEvents.Num() == 1)
+	{
+		Subsystem->ScheduleComponent(this);
+	}
+}
+
+bool UNetworkReplicationComponent::SendEvent(FReplicationBatchedEvent&& Event, EReplicationSendPriority BudgetPriority)
+{
+	if (TryFanOutEvent(Event, BudgetPriority))
+	{
+		return true;
+	}
+
+	// Everything else is multicast, so it is charged to each connection with a channel for the owner
+	UNetworkReplicationSubsystem* Subsystem = GetReplicationSubsystem();
+	if (Subsystem && !Subsystem->ConsumeSendBudget(GetOwner(), Event.GetEstimatedWireBytes(), BudgetPriority))
+	{
+		return false;
+	}
+
+	const bool bUnreliable = IsUnreliableCosmetic(Event);
+	if (bBatchEvents)
+	{
+		(bUnreliable ? PendingCosmeticBatch : PendingEventBatch).Events.Add(MoveTemp(Event));
+		return true;
+	}
+
+	switch (Event.Type)
+	{
+	case EReplicationEventType::Sound:
+		if (bUnreliable)
+		{
+			MulticastPlaySoundUnreliable(Cast<USoundBase>(Event.Asset), Event.VolumeMultiplier, Event.PitchMultiplier, Event.StartTime);
+		}
+		else
+		{
+			MulticastPlaySound(Cast<USoundBase>(Event.Asset), Event.VolumeMultiplier, Event.PitchMultiplier, Event.StartTime);
+		}
+		break;
+	case EReplicationEventType::SoundAtLocation:
+		if (bUnreliable)
+		{
+			MulticastPlaySoundAtLocationUnreliable(Cast<USoundBase>(Event.Asset), Event.QuantizedLocation, Event.VolumeMultiplier, Event.PitchMultiplier, Event.StartTime);
+		}
+		else
+		{
+			MulticastPlaySoundAtLocation(Cast<USoundBase>(Event.Asset), Event.QuantizedLocation, Event.VolumeMultiplier, Event.PitchMultiplier, Event.StartTime);
+		}
+		break;
+	case EReplicationEventType::NiagaraEffect:
+	{
+		FName AttachSocketName;
+		ResolveNetName(Event.Name, AttachSocketName);
+		if (bUnreliable)
+		{
+			MulticastSpawnNiagaraEffectUnreliable(Cast<UNiagaraSystem>(Event.Asset), Event.Location, Event.Rotation, Event.bAttachToOwner, AttachSocketName);
+		}
+		else
+		{
+			MulticastSpawnNiagaraEffect(Cast<UNiagaraSystem>(Event.Asset), Event.Location, Event.Rotation, Event.bAttachToOwner, AttachSocketName);
+		}
+		break;
+	}
+	case EReplicationEventType::Variable:
+		MulticastReplicateVariable(Event.Name, Event.Value);
+		break;
+	case EReplicationEventType::CustomEvent:
+		MulticastReplicateCustomEvent(Event.Name, Event.Data);
+		break;
+	case EReplicationEventType::StructEvent:
+		MulticastReplicateStructEvent(Event.Name, Event.Payload);
+		break;
+	default:
+		break;
+	}
+
+	return true;
+}
+
+bool UNetworkReplicationComponent::TryFanOutEvent(const FReplicationBatchedEvent& Event, EReplicationSendPriority BudgetPriority)
+{
+	UNetworkReplicationSubsystem* Subsystem = GetReplicationSubsystem();
+	if (!Subsystem || !Subsystem->IsEventFanOutEnabled() || GetNetMode() == NM_Standalone || GetNetMode() == NM_Client)
+	{
+		return false;
+	}
+
+	// Attached effects follow the owner on every client, so they keep the multicast
+	const bool bLocatedSound = Event.Type == EReplicationEventType::SoundAtLocation;
+	const bool bLocatedEffect = Event.Type == EReplicationEventType::NiagaraEffect && !Event.bAttachToOwner;
+	if (!(bLocatedSound || bLocatedEffect) || !Event.Asset)
+	{
+		return false;
+	}
+
+	// Players beyond the relevancy distance would not receive the multicast either
+	float Radius = GetEventAudibleRadius(Event);
+	const float CullDistance = Subsystem->GetRelevancyCullDistance();
+	if (CullDistance > 0.0f)
+	{
+		Radius = FMath::Min(Radius, CullDistance);
+	}
+
+	// An unbounded event reaches every player, which is what the multicast already does
+	if (Radius <= 0.0f || Radius >= WORLD_MAX)
+	{
+		return false;
+	}
+
+	FVector Location = Event.Location;
+	if (bLocatedSound && !DequantizeField(EReplicationQuantizedField::SoundLocation, Event.QuantizedLocation, Location))
+	{
+		return false;
+	}
+	const bool bUnreliable = IsUnreliableCosmetic(Event);
+	TArray<APlayerController*> Audience;
+	Subsystem->GatherEventAudience(Location, Radius, Audience);
+
+	// Local playback can submit new events and move the queue this event lives in, so read it once up front
+	USoundBase* Sound = Cast<USoundBase>(Event.Asset);
+	UNiagaraSystem* Effect = Cast<UNiagaraSystem>(Event.Asset);
+	const FQuantizedValue QuantizedLocation = Event.QuantizedLocation;
+	const FVector EffectLocation = Event.Location;
+	const FRotator EffectRotation = Event.Rotation;
+	const float VolumeMultiplier = Event.VolumeMultiplier;
+	const float PitchMultiplier = Event.PitchMultiplier;
+	const float StartTime = Event.StartTime;
+	const int32 Bytes = Event.GetEstimatedWireBytes();
+
+	int32 NumSends = 0;
+	bool bPlayLocally = false;
+	for (APlayerController* PlayerController : Audience)
+	{
+		// A listen server's own player has no connection to send to
+		if (PlayerController->IsLocalController())
+		{
+			bPlayLocally = true;
+			continue;
+		}
+
+		UNetworkReplicationRelayComponent* Relay = Subsystem->GetConnectionRelay(PlayerController);
+		if (!Relay)
+		{
+			continue;
+		}
+
+		// Only this player's connection pays for the send, so a saturated client misses the effect without holding back anyone else
+		if (!Subsystem->ConsumeConnectionSendBudget(PlayerController->GetNetConnection(), Bytes, BudgetPriority))
+		{
+			Subsystem->RecordBudgetedBytes(Bytes, true);
+			continue;
+		}
+
+		// The relay hands each send back to this component, so receivers fire its delegates and use its profile
+		if (bLocatedSound && bUnreliable)
+		{
+			Relay->ClientPlaySoundAtLocationUnreliable(this, Sound, QuantizedLocation, VolumeMultiplier, PitchMultiplier, StartTime);
+		}
+		else if (bLocatedSound)
+		{
+			Relay->ClientPlaySoundAtLocation(this, Sound, QuantizedLocation, VolumeMultiplier, PitchMultiplier, StartTime);
+		}
+		else if (bUnreliable)
+		{
+			Relay->ClientSpawnNiagaraEffectUnreliable(this, Effect, EffectLocation, EffectRotation);
+		}
+		else
+		{
+			Relay->ClientSpawnNiagaraEffect(this, Effect, EffectLocation, EffectRotation);
+		}
+		NumSends++;
+	}
+
+	// Played after the sends, since Blueprint handlers may replicate more events from here
+	if (bPlayLocally)
+	{
+		if (bLocatedSound)
+		{
+			MulticastPlaySoundAtLocation_Implementation(Sound, QuantizedLocation, VolumeMultiplier, PitchMultiplier, StartTime);
+		}
+		else
+		{
+			MulticastSpawnNiagaraEffect_Implementation(Effect, EffectLocation, EffectRotation, false, NAME_None);
+		}
+	}
+
+	Subsystem->RecordFanOut(NumSends, FMath::Max(GetWorld()->GetNumPlayerControllers() - Audience.Num(), 0));
+	return true;
+}
+
+bool UNetworkReplicationComponent::IsUnreliableCosmetic(const FReplicationBatchedEvent& Event) const
+{
+	return !bReliableCosmeticEvents && Event.GetSendPriority() == EReplicationSendPriority::Low;
+}
+
+float UNetworkReplicationComponent::GetEventAudibleRadius(const FReplicationBatchedEvent& Event)
+{
+	// Attenuation gives sounds a hard audible range; sounds without one are 2D and return WORLD_MAX
+	if (const USoundBase* Sound = Cast<USoundBase>(Event.Asset))
+	{
+		return Sound->GetMaxDistance();
+	}
+
+	// Effects are only visible out to their scalability cull distance, when they have one
+	if (const UNiagaraSystem* Effect = Cast<UNiagaraSystem>(Event.Asset))
+	{
+		const FNiagaraSystemScalabilitySettings& Scalability = Effect->GetScalabilitySettings();
+		return Scalability.bCullByDistance ? Scalability.MaxDistance : WORLD_MAX;
+	}
+
+	return WORLD_MAX;
+}
+
+int32 UNetworkReplicationComponent::SendQueuedEvents(int32 MaxBytes)
+{
+	UNetworkReplicationSubsystem* Subsystem = GetReplicationSubsystem();
+	const double Now = GetWorld()->GetTimeSeconds();
+	const float MaxCosmeticDelay = Subsystem ? Subsystem->GetReplicationSettings().MaxCosmeticEventDelay : 0.0f;
+
+	// Local playback on a listen server can submit new events, so send from a local queue that can not reallocate underneath us
+	TArray<FReplicationBatchedEvent> Pending = MoveTemp(OutboundEvents);
+	OutboundEvents.Reset();
+
+	int32 SentBytes = 0;
+	int32 NumProcessed = 0;
+	for (; NumProcessed < Pending.Num() && SentBytes < MaxBytes; NumProcessed++)
+	{
+		FReplicationBatchedEvent& Event = Pending[NumProcessed];
+		const EReplicationSendPriority Priority = Event.GetSendPriority();
+		const int32 Bytes = Event.GetEstimatedWireBytes();
+
+		// A late cosmetic effect is worse than none
+		if (Priority == EReplicationSendPriority::Low && Now - Event.QueuedTime > MaxCosmeticDelay)
+		{
+			if (Subsystem)
+			{
+				Subsystem->RecordBudgetedBytes(Bytes, true);
+			}
+			continue;
+		}
+
+		// Events that missed the frame they were queued in count as deferred
+		const bool bDeferred = Event.QueuedTime < Now;
+		if (!SendEvent(MoveTemp(Event), Priority))
+		{
+			// A cosmetic would only arrive late, so drop it rather than hold up the gameplay events behind it
+			if (Priority == EReplicationSendPriority::Low)
+			{
+				if (Subsystem)
+				{
+					Subsystem->RecordBudgetedBytes(Bytes, true);
+				}
+				continue;
+			}
+			break;
+		}
+
+		if (Subsystem && bDeferred)
+		{
+			Subsystem->RecordBudgetedBytes(Bytes, false);
+		}
+		SentBytes += Bytes;
+	}
+
+	// Whatever was left over keeps its place ahead of events submitted while sending
+	if (NumProcessed < Pending.Num())
+	{
+		Pending.RemoveAt(0, NumProcessed, EAllowShrinking::No);
+		Pending.Append(MoveTemp(OutboundEvents));
+		OutboundEvents = MoveTemp(Pending);
+	}
+
+	// The scheduler runs after component ticks, so send the batch now rather than a frame late
+	if (HasPendingEventBatch())
+	{
+		FlushEventBatch();
+	}
+
+	return SentBytes;
+}
+
+void UNetworkReplicationComponent::ChargeSendBudget(int32 Bytes)
+{
+	// Every immediate server send and replicated property change is charged here, so it doubles as the dormancy wake point
+	MarkReplicationActivity();
+
+	if (UNetworkReplicationSubsystem* Subsystem = GetReplicationSubsystem())
+	{
+		Subsystem->ConsumeSendBudget(GetOwner(), Bytes, EReplicationSendPriority::Critical);
+	}
+}
+
+// ===== NET DORMANCY IMPLEMENTATIONS =====
+
+void UNetworkReplicationComponent::MarkReplicationActivity()
+{
+	AActor* Owner = GetOwner();
+	UWorld* World = GetWorld();
+	if (!Owner || !World || !Owner->HasAuthority())
+	{
+		return;
+	}
+
+	LastReplicationActivityTime = World->GetTimeSeconds();
+	if (!bOwnerAutoDormant)
+	{
+		return;
+	}
+
+	// Push out anything changed while dormant, then stay awake so RPCs reach every connection
+	Owner->FlushNetDormancy();
+	Owner->SetNetDormancy(DORM_Awake);
+	SetOwnerAutoDormant(false);
+
+	if (UNetworkReplicationSubsystem* Subsystem = GetReplicationSubsystem())
+	{
+		Subsystem->RecordDormancyTransition(false);
+	}
+}
+
+void UNetworkReplicationComponent::UpdateAutoDormancy()
+{
+	UNetworkReplicationSubsystem* Subsystem = GetReplicationSubsystem();
+	AActor* Owner = GetOwner();
+	if (!Subsystem || !Owner || bOwnerAutoDormant || Subsystem->GetDormancyIdleSeconds() <= 0.0f)
+	{
+		return;
+	}
+
+	// Only owners left awake by their designer are managed; explicit dormancy settings are respected
+	if (!Owner->HasAuthority() || !Owner->GetIsReplicated() || Owner->NetDormancy != DORM_Awake || GetNetMode() == NM_Standalone)
+	{
+		return;
+	}
+
+	// Controllers and other owner-only actors, such as the hosts of fan-out relays, carry per-connection traffic and stay awake
+	if (Owner->bOnlyRelevantToOwner)
+	{
+		return;
+	}
+
+	// A client can not open a channel to a dormant actor, so its server RPCs on an owned pawn would be dropped unseen
+	if (Owner->GetNetConnection() != nullptr)
+	{
+		return;
+	}
+
+	// Every replication component on the owner shares its actor channel, so all of them must be idle
+	const double Now = GetWorld()->GetTimeSeconds();
+	const float IdleSeconds = Subsystem->GetDormancyIdleSeconds();
+	TInlineComponentArray<UNetworkReplicationComponent*> Siblings(Owner);
+	for (const UNetworkReplicationComponent* Sibling : Siblings)
+	{
+		if (!Sibling->IsIdleForDormancy(Now, IdleSeconds))
+		{
+			return;
+		}
+	}
+
+	Owner->SetNetDormancy(DORM_DormantAll);
+	SetOwnerAutoDormant(true);
+	Subsystem->RecordDormancyTransition(true);
+}
+
+bool UNetworkReplicationComponent::IsIdleForDormancy(double Now, float IdleSeconds) const
+{
+	return Now - LastReplicationActivityTime >= IdleSeconds
+		&& OutboundEvents.Num() == 0
+		&& !HasPendingEventBatch()
+		&& NumPendingVariables == 0
+		&& NumUnackedStates == 0
+		&& CoalescedVariables.Num() == 0
+		&& !bHasCoalescedTrajectory;
+}
+
+void UNetworkReplicationComponent::SetOwnerAutoDormant(bool bDormant)
+{
+	TInlineComponentArray<UNetworkReplicationComponent*> Siblings(GetOwner());
+	for (UNetworkReplicationComponent* Sibling : Siblings)
+	{
+		Sibling->bOwnerAutoDormant = bDormant;
+	}
+}
+
+void UNetworkReplicationComponent::FlushEventBatch()
+{
+	if (!HasPendingEventBatch())
+	{
+		return;
+	}
+
+	// Split oversized frames so each batch stays within what receivers accept
+	while (PendingEventBatch.Events.Num() > FReplicationEventBatch::MaxEvents)
+	{
+		FReplicationEventBatch Chunk;
+		Chunk.Events.Append(PendingEventBatch.Events.GetData(), FReplicationEventBatch::MaxEvents);
+		PendingEventBatch.Events.RemoveAt(0, FReplicationEventBatch::MaxEvents, EAllowShrinking::No);
+		MulticastReplicateEventBatch(Chunk);
+	}
+
+	while (PendingCosmeticBatch.Events.Num() > FReplicationEventBatch::MaxEvents)
+	{
+		FReplicationEventBatch Chunk;
+		Chunk.Events.Append(PendingCosmeticBatch.Events.GetData(), FReplicationEventBatch::MaxEvents);
+		PendingCosmeticBatch.Events.RemoveAt(0, FReplicationEventBatch::MaxEvents, EAllowShrinking::No);
+		MulticastReplicateCosmeticEventBatch(Chunk);
+	}
+
+	if (bDebugMode)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Flushing event batch: %d events, %d cosmetic"), PendingEventBatch.Events.Num(), PendingCosmeticBatch.Events.Num());
+	}
+
+	if (PendingEventBatch.Events.Num() > 0)
+	{
+		MulticastReplicateEventBatch(PendingEventBatch);
+		PendingEventBatch.Events.Reset();
+	}
+
+	if (PendingCosmeticBatch.Events.Num() > 0)
+	{
+		MulticastReplicateCosmeticEventBatch(PendingCosmeticBatch);
+		PendingCosmeticBatch.Events.Reset();
+	}
+}
+
+void UNetworkReplicationComponent::MulticastReplicateCosmeticEventBatch_Implementation(const FReplicationEventBatch& Batch)
+{
+	// Only sound and Niagara events are put in this batch, and their handlers return early on dedicated servers
+	if (!ShouldSkipCosmeticPlayback())
+	{
+		MulticastReplicateEventBatch_Implementation(Batch);
+	}
+}
+
+void UNetworkReplicationComponent::MulticastReplicateEventBatch_Implementation(const FReplicationEventBatch& Batch)
+{
+	// Hold the whole batch until every name id is known so events still replay in order
+	for (const FReplicationBatchedEvent& Event : Batch.Events)
+	{
+		FName ResolvedName;
+		if (!ResolveNetNameInOrder(Event.Name, ResolvedName))
+		{
+			ParkUntilNameResolved(Event.Name, [this, Batch]() { MulticastReplicateEventBatch_Implementation(Batch); });
+			return;
+		}
+	}
+
+	// Replay in queue order through the same handlers the individual multicasts use
+	for (const FReplicationBatchedEvent& Event : Batch.Events)
+	{
+		FName EventName;
+		ResolveNetName(Event.Name, EventName);
+
+		switch (Event.Type)
+		{
+		case EReplicationEventType::Sound:
+			if (USoundBase* Sound = Cast<USoundBase>(Event.Asset))
+			{
+				MulticastPlaySound_Implementation(Sound, Event.VolumeMultiplier, Event.PitchMultiplier, Event.StartTime);
+			}
+			break;
+		case EReplicationEventType::SoundAtLocation:
+			if (USoundBase* Sound = Cast<USoundBase>(Event.Asset))
+			{
+				MulticastPlaySoundAtLocation_Implementation(Sound, Event.QuantizedLocation, Event.VolumeMultiplier, Event.PitchMultiplier, Event.StartTime);
+			}
+			break;
+		case EReplicationEventType::NiagaraEffect:
+			if (UNiagaraSystem* Effect = Cast<UNiagaraSystem>(Event.Asset))
+			{
+				MulticastSpawnNiagaraEffect_Implementation(Effect, Event.Location, Event.Rotation, Event.bAttachToOwner, EventName);
+			}
+			break;
+		case EReplicationEventType::Variable:
+			MulticastReplicateVariable_Implementation(FReplicatedNameId(EventName), Event.Value);
+			break;
+		case EReplicationEventType::CustomEvent:
+			MulticastReplicateCustomEvent_Implementation(FReplicatedNameId(EventName), FReplicationCompressedString(Event.Data));
+			break;
+		case EReplicationEventType::StructEvent:
+			MulticastReplicateStructEvent_Implementation(FReplicatedNameId(EventName), Event.Payload);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+// ===== MOTION MATCHING IMPLEMENTATIONS =====
 
 /**
  * Replicates motion matching database data across the network
@@ -637,6 +2205,7 @@ void UNetworkReplicationComponent::ReplicateMotionMatchingDatabase(UObject* Data
 	if (GetOwner()->HasAuthority())
 	{
 		// Server: Directly multicast to all clients
+		ChargeSendBudget(ReplicationWireSize::RPCHeader + ReplicationWireSize::ObjectReference);
 		MulticastReplicateMotionMatchingDatabase(Database);
 	}
 	else
@@ -646,8 +2215,7 @@ void UNetworkReplicationComponent::ReplicateMotionMatchingDatabase(UObject* Data
 	}
 	
 	// Update replication statistics for monitoring
-	TotalReplications++;
-	LastReplicationTime = GetWorld()->GetTimeSeconds();
+	RecordReplication(EReplicationRPCFamily::MotionMatching);
 }
 
 void UNetworkReplicationComponent::ReplicatePoseSearchSchema(UObject* Schema)
@@ -665,6 +2233,7 @@ void UNetworkReplicationComponent::ReplicatePoseSearchSchema(UObject* Schema)
 
 	if (GetOwner()->HasAuthority())
 	{
+		ChargeSendBudget(ReplicationWireSize::RPCHeader + ReplicationWireSize::ObjectReference);
 		MulticastReplicatePoseSearchSchema(Schema);
 	}
 	else
@@ -672,8 +2241,7 @@ void UNetworkReplicationComponent::ReplicatePoseSearchSchema(UObject* Schema)
 		ServerReplicatePoseSearchSchema(Schema);
 	}
 	
-	TotalReplications++;
-	LastReplicationTime = GetWorld()->GetTimeSeconds();
+	RecordReplication(EReplicationRPCFamily::MotionMatching);
 }
 
 void UNetworkReplicationComponent::ReplicateTrajectoryData(const FVector& Position, const FRotator& Rotation)
@@ -684,32 +2252,55 @@ void UNetworkReplicationComponent::ReplicateTrajectoryData(const FVector& Positi
 			*Position.ToString(), *Rotation.ToString());
 	}
 
+	// Rotators travel as (Pitch, Yaw, Roll) so angle rules can pack each axis
+	const FQuantizedValue NetPosition = QuantizeField(EReplicationQuantizedField::TrajectoryPosition, Position);
+	const FQuantizedValue NetRotation = QuantizeField(EReplicationQuantizedField::TrajectoryRotation, FVector(Rotation.Pitch, Rotation.Yaw, Rotation.Roll));
+
 	if (GetOwner()->HasAuthority())
 	{
-		MulticastReplicateTrajectoryData(Position, Rotation);
+		ChargeSendBudget(ReplicationWireSize::RPCHeader + NetPosition.GetEstimatedWireBytes() + NetRotation.GetEstimatedWireBytes());
+		MulticastReplicateTrajectoryData(NetPosition, NetRotation);
 	}
 	else
 	{
-		ServerReplicateTrajectoryData(Position, Rotation);
+		ServerReplicateTrajectoryData(NetPosition, NetRotation);
 	}
 	
-	TotalReplications++;
-	LastReplicationTime = GetWorld()->GetTimeSeconds();
+	RecordReplication(EReplicationRPCFamily::MotionMatching);
 }
 
 // Motion Matching Server RPC Implementations
 void UNetworkReplicationComponent::ServerReplicateMotionMatchingDatabase_Implementation(UObject* Database)
 {
-	MulticastReplicateMotionMatchingDatabase(Database);
+	if (PassesRateLimit(EReplicationRPCFamily::MotionMatching))
+	{
+		ChargeSendBudget(ReplicationWireSize::RPCHeader + ReplicationWireSize::ObjectReference);
+		MulticastReplicateMotionMatchingDatabase(Database);
+	}
 }
 
 void UNetworkReplicationComponent::ServerReplicatePoseSearchSchema_Implementation(UObject* Schema)
 {
-	MulticastReplicatePoseSearchSchema(Schema);
+	if (PassesRateLimit(EReplicationRPCFamily::MotionMatching))
+	{
+		ChargeSendBudget(ReplicationWireSize::RPCHeader + ReplicationWireSize::ObjectReference);
+		MulticastReplicatePoseSearchSchema(Schema);
+	}
 }
 
-void UNetworkReplicationComponent::ServerReplicateTrajectoryData_Implementation(FVector Position, FRotator Rotation)
+void UNetworkReplicationComponent::ServerReplicateTrajectoryData_Implementation(const FQuantizedValue& Position, const FQuantizedValue& Rotation)
 {
+	if (!PassesRateLimit(EReplicationRPCFamily::MotionMatching, true))
+	{
+		// Trajectory is continuous state, so keep only the newest sample
+		CoalescedTrajectoryPosition = Position;
+		CoalescedTrajectoryRotation = Rotation;
+		bHasCoalescedTrajectory = true;
+		return;
+	}
+
+	bHasCoalescedTrajectory = false;
+	ChargeSendBudget(ReplicationWireSize::RPCHeader + Position.GetEstimatedWireBytes() + Rotation.GetEstimatedWireBytes());
 	MulticastReplicateTrajectoryData(Position, Rotation);
 }
 
@@ -734,8 +2325,17 @@ void UNetworkReplicationComponent::MulticastReplicatePoseSearchSchema_Implementa
 	}
 }
 
-void UNetworkReplicationComponent::MulticastReplicateTrajectoryData_Implementation(FVector Position, FRotator Rotation)
+void UNetworkReplicationComponent::MulticastReplicateTrajectoryData_Implementation(const FQuantizedValue& NetPosition, const FQuantizedValue& NetRotation)
 {
+	FVector Position;
+	FVector RotationAxes;
+	if (!DequantizeField(EReplicationQuantizedField::TrajectoryPosition, NetPosition, Position)
+		|| !DequantizeField(EReplicationQuantizedField::TrajectoryRotation, NetRotation, RotationAxes))
+	{
+		return;
+	}
+	const FRotator Rotation(RotationAxes.X, RotationAxes.Y, RotationAxes.Z);
+
 	OnTrajectoryReplicated.Broadcast(Position, Rotation);
 	
 	if (bDebugMode)
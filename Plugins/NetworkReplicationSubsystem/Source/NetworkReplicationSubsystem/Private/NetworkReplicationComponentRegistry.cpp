@@ -0,0 +1,53 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationComponentRegistry.cpp
+// Implements the slot registry that tracks the subsystem's registered replication components.
+
+#include "NetworkReplicationComponentRegistry.h"
+
+FNetworkReplicationComponentHandle FNetworkReplicationComponentRegistry::Add(UNetworkReplicationComponent* Component)
+{
+	const int32 SlotIndex = FreeSlots.Num() > 0 ? FreeSlots.Pop(EAllowShrinking::No) : Slots.AddDefaulted();
+	FSlot& Slot = Slots[SlotIndex];
+	Slot.DenseIndex = Components.Add(Component);
+	ComponentSlots.Add(SlotIndex);
+
+	FNetworkReplicationComponentHandle Handle;
+	Handle.Index = SlotIndex;
+	Handle.Generation = Slot.Generation;
+	return Handle;
+}
+
+bool FNetworkReplicationComponentRegistry::Remove(const FNetworkReplicationComponentHandle& Handle)
+{
+	if (!IsValidHandle(Handle))
+	{
+		return false;
+	}
+
+	FSlot& Slot = Slots[Handle.Index];
+	const int32 DenseIndex = Slot.DenseIndex;
+	const int32 LastIndex = Components.Num() - 1;
+	if (DenseIndex != LastIndex)
+	{
+		Components[DenseIndex] = Components[LastIndex];
+		ComponentSlots[DenseIndex] = ComponentSlots[LastIndex];
+		Slots[ComponentSlots[DenseIndex]].DenseIndex = DenseIndex;
+	}
+	Components.Pop(EAllowShrinking::No);
+	ComponentSlots.Pop(EAllowShrinking::No);
+
+	// Zero is never a live generation, so a default handle can not match a reused slot
+	Slot.DenseIndex = INDEX_NONE;
+	Slot.Generation = Slot.Generation == MAX_uint32 ? 1 : Slot.Generation + 1;
+	FreeSlots.Add(Handle.Index);
+	return true;
+}
+
+void FNetworkReplicationComponentRegistry::Reset()
+{
+	Slots.Reset();
+	FreeSlots.Reset();
+	Components.Reset();
+	ComponentSlots.Reset();
+}
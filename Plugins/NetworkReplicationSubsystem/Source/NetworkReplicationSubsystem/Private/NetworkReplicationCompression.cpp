@@ -0,0 +1,343 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationCompression.cpp
+// Implements the payload compression envelope and its FCompression and preset-dictionary codecs.
+
+#include "NetworkReplicationCompression.h"
+#include "NetworkReplicationCompressionDictionary.h"
+#include "NetworkReplicationSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/PackageMapClient.h"
+#include "Misc/Compression.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/IConsoleManager.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+namespace NetworkReplicationCompression
+{
+	static FName GetFormatName(EReplicationCompressionCodec Codec)
+	{
+		switch (Codec)
+		{
+		case EReplicationCompressionCodec::Zlib:
+			return NAME_Zlib;
+		case EReplicationCompressionCodec::Gzip:
+			return NAME_Gzip;
+		case EReplicationCompressionCodec::LZ4:
+			return NAME_LZ4;
+		case EReplicationCompressionCodec::Oodle:
+			return NAME_Oodle;
+		default:
+			return NAME_None;
+		}
+	}
+
+	static bool DeflateWithDictionary(const TArray<uint8>& Dictionary, const uint8* Source, int32 SourceSize, TArray<uint8>& OutCompressed)
+	{
+		z_stream Stream;
+		FMemory::Memzero(Stream);
+		if (deflateInit(&Stream, Z_DEFAULT_COMPRESSION) != Z_OK)
+		{
+			return false;
+		}
+
+		bool bSuccess = deflateSetDictionary(&Stream, Dictionary.GetData(), Dictionary.Num()) == Z_OK;
+
+		OutCompressed.SetNumUninitialized(deflateBound(&Stream, SourceSize));
+		Stream.next_in = const_cast<Bytef*>(Source);
+		Stream.avail_in = SourceSize;
+		Stream.next_out = OutCompressed.GetData();
+		Stream.avail_out = OutCompressed.Num();
+
+		bSuccess = bSuccess && deflate(&Stream, Z_FINISH) == Z_STREAM_END;
+		OutCompressed.SetNum(Stream.total_out, EAllowShrinking::No);
+		deflateEnd(&Stream);
+		return bSuccess;
+	}
+
+	static bool InflateWithDictionary(const TArray<uint8>& Dictionary, const uint8* Source, int32 SourceSize, uint8* Dest, int32 DestSize)
+	{
+		z_stream Stream;
+		FMemory::Memzero(Stream);
+		if (inflateInit(&Stream) != Z_OK)
+		{
+			return false;
+		}
+
+		Stream.next_in = const_cast<Bytef*>(Source);
+		Stream.avail_in = SourceSize;
+		Stream.next_out = Dest;
+		Stream.avail_out = DestSize;
+
+		int32 Result = inflate(&Stream, Z_FINISH);
+		if (Result == Z_NEED_DICT && inflateSetDictionary(&Stream, Dictionary.GetData(), Dictionary.Num()) == Z_OK)
+		{
+			Result = inflate(&Stream, Z_FINISH);
+		}
+
+		const bool bSuccess = Result == Z_STREAM_END && Stream.total_out == static_cast<uLong>(DestSize);
+		inflateEnd(&Stream);
+		return bSuccess;
+	}
+}
+
+void FNetworkReplicationCompressor::Configure(bool bInEnabled, EReplicationCompressionCodec InCodec, int32 InThresholdBytes, const UNetworkReplicationCompressionDictionary* InDictionary)
+{
+	bEnabled = bInEnabled;
+	Codec = InCodec;
+	ThresholdBytes = FMath::Max(InThresholdBytes, 0);
+	Dictionary = InDictionary;
+
+	// A cached result was produced with the old settings
+	for (FWrittenPayload& Written : LastWritten)
+	{
+		Written = FWrittenPayload();
+	}
+
+	if (bEnabled && Codec == EReplicationCompressionCodec::ZlibDictionary && (!InDictionary || InDictionary->DictionaryData.Num() == 0))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ZlibDictionary compression selected without a trained dictionary, payloads will be sent uncompressed"));
+	}
+
+	// Iris hands NetSerialize a package map with no connection, so payloads can not find the subsystem's compressor
+	static bool bWarnedIris = false;
+	const IConsoleVariable* UseIrisCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("net.Iris.UseIrisReplication"));
+	if (bEnabled && !bWarnedIris && UseIrisCVar && UseIrisCVar->GetInt() != 0)
+	{
+		bWarnedIris = true;
+		UE_LOG(LogTemp, Warning, TEXT("Payload compression is not supported under Iris replication, payloads will be sent uncompressed"));
+	}
+}
+
+FNetworkReplicationCompressor* FNetworkReplicationCompressor::FindForPackageMap(UPackageMap* Map)
+{
+	const UPackageMapClient* PackageMapClient = Cast<UPackageMapClient>(Map);
+	const UNetConnection* Connection = PackageMapClient ? PackageMapClient->GetConnection() : nullptr;
+	const UNetDriver* Driver = Connection ? Connection->GetDriver() : nullptr;
+	const UWorld* World = Driver ? Driver->GetWorld() : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+
+	if (UNetworkReplicationSubsystem* Subsystem = GameInstance ? GameInstance->GetSubsystem<UNetworkReplicationSubsystem>() : nullptr)
+	{
+		return &Subsystem->GetPayloadCompressor();
+	}
+	return nullptr;
+}
+
+void FNetworkReplicationCompressor::SerializePayload(FArchive& Ar, UPackageMap* Map, EReplicationPayloadCategory Category, TArray<uint8>& Data, int64& NumBits)
+{
+	// Without a subsystem, payloads are written raw and any codec except the dictionary one can still be read
+	static FNetworkReplicationCompressor FallbackCompressor;
+
+	FNetworkReplicationCompressor* Compressor = FindForPackageMap(Map);
+	if (!Compressor)
+	{
+		Compressor = &FallbackCompressor;
+	}
+
+	if (Ar.IsLoading())
+	{
+		Compressor->ReadPayload(Ar, Category, Data, NumBits);
+	}
+	else
+	{
+		Compressor->WritePayload(Ar, Category, Data, NumBits);
+	}
+}
+
+void FNetworkReplicationCompressor::WritePayload(FArchive& Ar, EReplicationPayloadCategory Category, const TArray<uint8>& Data, int64 NumBits)
+{
+	FReplicationCompressionStats& CategoryStats = Stats[static_cast<int32>(Category)];
+	const int32 NumBytes = static_cast<int32>((NumBits + 7) >> 3);
+
+	// The same multicast written for the next connection reuses the first result
+	FWrittenPayload& Written = LastWritten[static_cast<int32>(Category)];
+	const bool bRepeat = Written.Frame == GFrameCounter && Written.NumBits == NumBits && Written.Raw.Num() == NumBytes
+		&& FMemory::Memcmp(Written.Raw.GetData(), Data.GetData(), NumBytes) == 0;
+
+	if (!bRepeat)
+	{
+		Written.Frame = GFrameCounter;
+		Written.NumBits = NumBits;
+		Written.Raw = TArray<uint8>(Data.GetData(), NumBytes);
+		Written.Compressed.Reset();
+		Written.bCompressed = false;
+
+		if (bCapturing && NumBytes > 0 && CapturedSamples.Num() < MaxCapturedSamples)
+		{
+			CapturedSamples.Emplace(Data.GetData(), NumBytes);
+		}
+
+		if (bEnabled && Codec != EReplicationCompressionCodec::None && NumBytes >= ThresholdBytes && NumBytes > 0)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			// Only worth it if the result is actually smaller
+			Written.bCompressed = Compress(Data.GetData(), NumBytes, Written.Compressed) && Written.Compressed.Num() < NumBytes;
+			CategoryStats.CompressSeconds += FPlatformTime::Seconds() - StartTime;
+		}
+
+		CategoryStats.Payloads++;
+		CategoryStats.RawBytes += NumBytes;
+		CategoryStats.WireBytes += Written.bCompressed ? Written.Compressed.Num() : NumBytes;
+		CategoryStats.CompressedPayloads += Written.bCompressed ? 1 : 0;
+	}
+
+	const TArray<uint8>& Compressed = Written.Compressed;
+	const bool bCompressed = Written.bCompressed;
+
+	uint8 CompressedBit = bCompressed ? 1 : 0;
+	Ar.SerializeBits(&CompressedBit, 1);
+
+	uint64 PayloadBits = static_cast<uint64>(NumBits);
+	Ar.SerializeIntPacked64(PayloadBits);
+
+	if (!bCompressed)
+	{
+		Ar.SerializeBits(const_cast<uint8*>(Data.GetData()), NumBits);
+		return;
+	}
+
+	uint32 CodecValue = static_cast<uint32>(Codec);
+	Ar.SerializeInt(CodecValue, static_cast<uint32>(EReplicationCompressionCodec::Count));
+
+	if (Codec == EReplicationCompressionCodec::ZlibDictionary)
+	{
+		uint32 DictionaryHash = Dictionary->DictionaryHash;
+		Ar << DictionaryHash;
+	}
+
+	uint32 CompressedSize = Compressed.Num();
+	Ar.SerializeIntPacked(CompressedSize);
+	Ar.Serialize(const_cast<uint8*>(Compressed.GetData()), CompressedSize);
+}
+
+void FNetworkReplicationCompressor::ReadPayload(FArchive& Ar, EReplicationPayloadCategory Category, TArray<uint8>& Data, int64& NumBits)
+{
+	uint8 CompressedBit = 0;
+	Ar.SerializeBits(&CompressedBit, 1);
+
+	uint64 PayloadBits = 0;
+	Ar.SerializeIntPacked64(PayloadBits);
+
+	const int64 NumBytes = static_cast<int64>((PayloadBits + 7) >> 3);
+	if (Ar.IsError() || NumBytes > MaxPayloadBytes)
+	{
+		Ar.SetError();
+		return;
+	}
+
+	NumBits = static_cast<int64>(PayloadBits);
+	Data.SetNumZeroed(NumBytes);
+
+	if (!(CompressedBit & 1))
+	{
+		Ar.SerializeBits(Data.GetData(), NumBits);
+		return;
+	}
+
+	uint32 CodecValue = 0;
+	Ar.SerializeInt(CodecValue, static_cast<uint32>(EReplicationCompressionCodec::Count));
+	const EReplicationCompressionCodec PayloadCodec = static_cast<EReplicationCompressionCodec>(CodecValue);
+
+	if (PayloadCodec == EReplicationCompressionCodec::ZlibDictionary)
+	{
+		uint32 DictionaryHash = 0;
+		Ar << DictionaryHash;
+
+		if (!Dictionary.IsValid() || Dictionary->DictionaryHash != DictionaryHash)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Received a payload compressed with dictionary %08x, which is not the configured dictionary"), DictionaryHash);
+			Ar.SetError();
+			return;
+		}
+	}
+
+	uint32 CompressedSize = 0;
+	Ar.SerializeIntPacked(CompressedSize);
+	if (Ar.IsError() || CompressedSize > MaxPayloadBytes)
+	{
+		Ar.SetError();
+		return;
+	}
+
+	TArray<uint8> Compressed;
+	Compressed.SetNumUninitialized(CompressedSize);
+	Ar.Serialize(Compressed.GetData(), CompressedSize);
+	if (Ar.IsError())
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const bool bDecompressed = Decompress(PayloadCodec, Compressed.GetData(), CompressedSize, Data.GetData(), static_cast<int32>(NumBytes));
+	Stats[static_cast<int32>(Category)].DecompressSeconds += FPlatformTime::Seconds() - StartTime;
+
+	if (!bDecompressed)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to decompress replication payload (codec %d, %u bytes)"), static_cast<int32>(PayloadCodec), CompressedSize);
+		Ar.SetError();
+	}
+}
+
+bool FNetworkReplicationCompressor::Compress(const uint8* Source, int32 SourceSize, TArray<uint8>& OutCompressed) const
+{
+	if (Codec == EReplicationCompressionCodec::ZlibDictionary)
+	{
+		const UNetworkReplicationCompressionDictionary* DictionaryAsset = Dictionary.Get();
+		return DictionaryAsset && DictionaryAsset->DictionaryData.Num() > 0
+			&& NetworkReplicationCompression::DeflateWithDictionary(DictionaryAsset->DictionaryData, Source, SourceSize, OutCompressed);
+	}
+
+	const FName FormatName = NetworkReplicationCompression::GetFormatName(Codec);
+	if (FormatName.IsNone())
+	{
+		return false;
+	}
+
+	int32 CompressedSize = FCompression::CompressMemoryBound(FormatName, SourceSize);
+	OutCompressed.SetNumUninitialized(CompressedSize);
+	if (!FCompression::CompressMemory(FormatName, OutCompressed.GetData(), CompressedSize, Source, SourceSize))
+	{
+		return false;
+	}
+
+	OutCompressed.SetNum(CompressedSize, EAllowShrinking::No);
+	return true;
+}
+
+bool FNetworkReplicationCompressor::Decompress(EReplicationCompressionCodec InCodec, const uint8* Source, int32 SourceSize, uint8* Dest, int32 DestSize) const
+{
+	if (InCodec == EReplicationCompressionCodec::ZlibDictionary)
+	{
+		const UNetworkReplicationCompressionDictionary* DictionaryAsset = Dictionary.Get();
+		return DictionaryAsset && NetworkReplicationCompression::InflateWithDictionary(DictionaryAsset->DictionaryData, Source, SourceSize, Dest, DestSize);
+	}
+
+	const FName FormatName = NetworkReplicationCompression::GetFormatName(InCodec);
+	return !FormatName.IsNone() && FCompression::UncompressMemory(FormatName, Dest, DestSize, Source, SourceSize);
+}
+
+void FNetworkReplicationCompressor::ResetStats()
+{
+	for (FReplicationCompressionStats& CategoryStats : Stats)
+	{
+		CategoryStats = FReplicationCompressionStats();
+	}
+}
+
+void FNetworkReplicationCompressor::StartCapture()
+{
+	CapturedSamples.Reset();
+	bCapturing = true;
+}
+
+TArray<TArray<uint8>> FNetworkReplicationCompressor::StopCapture()
+{
+	bCapturing = false;
+	return MoveTemp(CapturedSamples);
+}
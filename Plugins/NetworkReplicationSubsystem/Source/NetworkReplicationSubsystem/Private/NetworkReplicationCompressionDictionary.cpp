@@ -0,0 +1,169 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationCompressionDictionary.cpp
+// Implements dictionary training and sample file handling for UNetworkReplicationCompressionDictionary.
+
+#include "NetworkReplicationCompressionDictionary.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace NetworkReplicationDictionaryTraining
+{
+	/** Substring length used to measure how much samples have in common */
+	static constexpr int32 GramSize = 8;
+
+	/** Length of the sample slices the dictionary is assembled from */
+	static constexpr int32 SegmentSize = 64;
+
+	static uint64 ReadGram(const uint8* Data)
+	{
+		uint64 Gram = 0;
+		FMemory::Memcpy(&Gram, Data, GramSize);
+		return Gram;
+	}
+
+	struct FSegment
+	{
+		const uint8* Data = nullptr;
+		int32 Size = 0;
+		int64 Score = 0;
+	};
+
+	/** Sum of sample counts for grams in the segment that the dictionary does not cover yet */
+	static int64 ScoreSegment(const FSegment& Segment, const TMap<uint64, int32>& GramSampleCounts, const TSet<uint64>& CoveredGrams)
+	{
+		int64 Score = 0;
+		for (int32 Offset = 0; Offset + GramSize <= Segment.Size; Offset++)
+		{
+			const uint64 Gram = ReadGram(Segment.Data + Offset);
+			const int32* SampleCount = GramSampleCounts.Find(Gram);
+			// A gram seen in a single sample never helps another payload
+			if (SampleCount && *SampleCount > 1 && !CoveredGrams.Contains(Gram))
+			{
+				Score += *SampleCount;
+			}
+		}
+		return Score;
+	}
+}
+
+void UNetworkReplicationCompressionDictionary::TrainFromSamples(const TArray<TArray<uint8>>& Samples)
+{
+	using namespace NetworkReplicationDictionaryTraining;
+
+	// Count each gram once per sample, so a payload repeating itself cannot dominate
+	TMap<uint64, int32> GramSampleCounts;
+	TSet<uint64> SampleGrams;
+	for (const TArray<uint8>& Sample : Samples)
+	{
+		SampleGrams.Reset();
+		for (int32 Offset = 0; Offset + GramSize <= Sample.Num(); Offset++)
+		{
+			SampleGrams.Add(ReadGram(Sample.GetData() + Offset));
+		}
+		for (uint64 Gram : SampleGrams)
+		{
+			GramSampleCounts.FindOrAdd(Gram)++;
+		}
+	}
+
+	// Overlapping candidate segments from every sample
+	TSet<uint64> CoveredGrams;
+	TArray<FSegment> Segments;
+	for (const TArray<uint8>& Sample : Samples)
+	{
+		for (int32 Offset = 0; Offset < Sample.Num(); Offset += SegmentSize / 2)
+		{
+			FSegment& Segment = Segments.AddDefaulted_GetRef();
+			Segment.Data = Sample.GetData() + Offset;
+			Segment.Size = FMath::Min(SegmentSize, Sample.Num() - Offset);
+			Segment.Score = ScoreSegment(Segment, GramSampleCounts, CoveredGrams);
+		}
+	}
+
+	// Lazy greedy selection: a segment's score only drops as coverage grows, so re-scoring the top is enough
+	auto ScorePredicate = [](const FSegment& A, const FSegment& B) { return A.Score > B.Score; };
+	Segments.Heapify(ScorePredicate);
+
+	TArray<FSegment> Selected;
+	int32 DictionarySize = 0;
+	while (Segments.Num() > 0 && DictionarySize < MaxDictionarySize)
+	{
+		FSegment Top;
+		Segments.HeapPop(Top, ScorePredicate, EAllowShrinking::No);
+
+		Top.Score = ScoreSegment(Top, GramSampleCounts, CoveredGrams);
+		if (Top.Score <= 0)
+		{
+			continue;
+		}
+
+		if (Segments.Num() > 0 && Top.Score < Segments.HeapTop().Score)
+		{
+			Segments.HeapPush(Top, ScorePredicate);
+			continue;
+		}
+
+		if (DictionarySize + Top.Size > MaxDictionarySize)
+		{
+			break;
+		}
+
+		for (int32 Offset = 0; Offset + GramSize <= Top.Size; Offset++)
+		{
+			CoveredGrams.Add(ReadGram(Top.Data + Offset));
+		}
+
+		Selected.Add(Top);
+		DictionarySize += Top.Size;
+	}
+
+	// Best segments go last, closest to the data being compressed
+	DictionaryData.Reset(DictionarySize);
+	for (int32 Index = Selected.Num() - 1; Index >= 0; Index--)
+	{
+		DictionaryData.Append(Selected[Index].Data, Selected[Index].Size);
+	}
+
+	DictionaryHash = FCrc::MemCrc32(DictionaryData.GetData(), DictionaryData.Num());
+
+	UE_LOG(LogTemp, Log, TEXT("Trained compression dictionary from %d samples: %d bytes, hash %08x"), Samples.Num(), DictionaryData.Num(), DictionaryHash);
+}
+
+bool UNetworkReplicationCompressionDictionary::SaveSamples(const FString& FilePath, const TArray<TArray<uint8>>& Samples)
+{
+	TArray<uint8> FileData;
+	FMemoryWriter Writer(FileData);
+	Writer << const_cast<TArray<TArray<uint8>>&>(Samples);
+	return FFileHelper::SaveArrayToFile(FileData, *FilePath);
+}
+
+bool UNetworkReplicationCompressionDictionary::LoadSamples(const FString& FilePath, TArray<TArray<uint8>>& OutSamples)
+{
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(FileData);
+	Reader << OutSamples;
+	return !Reader.IsError();
+}
+
+#if WITH_EDITOR
+void UNetworkReplicationCompressionDictionary::TrainFromSampleFile()
+{
+	TArray<TArray<uint8>> Samples;
+	if (!LoadSamples(SampleFile.FilePath, Samples))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Could not read compression samples from %s"), *SampleFile.FilePath);
+		return;
+	}
+
+	TrainFromSamples(Samples);
+	MarkPackageDirty();
+}
+#endif
@@ -0,0 +1,203 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationGraph.cpp
+// Implements the replication graph node that applies subsystem relevancy settings, and the sample graph.
+
+#include "NetworkReplicationGraph.h"
+#include "NetworkReplicationSubsystem.h"
+#include "NetworkReplicationComponent.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+// ===== REPLICATION GRAPH NODE =====
+
+UReplicationGraphNode_NetworkReplication::UReplicationGraphNode_NetworkReplication()
+{
+	bRequiresPrepareForReplicationCall = true;
+}
+
+void UReplicationGraphNode_NetworkReplication::Initialize(const TSharedPtr<FReplicationGraphGlobalData>& InGraphGlobals)
+{
+	Super::Initialize(InGraphGlobals);
+	AlwaysRelevantNode = CreateChildNode<UReplicationGraphNode_ActorList>();
+}
+
+void UReplicationGraphNode_NetworkReplication::NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+	AActor* Actor = ActorInfo.Actor;
+	if (!Actor || ActorPlacements.Contains(Actor))
+	{
+		return;
+	}
+
+	RefreshRouting();
+	PlaceActor(Actor);
+}
+
+bool UReplicationGraphNode_NetworkReplication::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound)
+{
+	bool bInGrid = false;
+	if (!ActorPlacements.RemoveAndCopyValue(ActorInfo.Actor, bInGrid))
+	{
+		UE_CLOG(bWarnIfNotFound, LogTemp, Warning, TEXT("NetworkReplication graph node asked to remove unknown actor %s"), *GetNameSafe(ActorInfo.Actor));
+		return false;
+	}
+
+	UnplaceActor(ActorInfo.Actor, bInGrid);
+	return true;
+}
+
+void UReplicationGraphNode_NetworkReplication::NotifyResetAllNetworkActors()
+{
+	ActorPlacements.Reset();
+	Super::NotifyResetAllNetworkActors();
+}
+
+void UReplicationGraphNode_NetworkReplication::PrepareForReplication()
+{
+	RefreshRouting();
+}
+
+void UReplicationGraphNode_NetworkReplication::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	// The grid is a global node and gathers itself; only the always relevant list belongs to this node
+	AlwaysRelevantNode->GatherActorListsForConnection(Params);
+}
+
+int32 UReplicationGraphNode_NetworkReplication::GetNumGridActors() const
+{
+	int32 NumGridActors = 0;
+	for (const TPair<TObjectKey<AActor>, bool>& Pair : ActorPlacements)
+	{
+		NumGridActors += Pair.Value ? 1 : 0;
+	}
+	return NumGridActors;
+}
+
+UNetworkReplicationSubsystem* UReplicationGraphNode_NetworkReplication::GetSubsystem() const
+{
+	UWorld* World = GraphGlobals.IsValid() ? ToRawPtr(GraphGlobals->World) : nullptr;
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UNetworkReplicationSubsystem>() : nullptr;
+}
+
+void UReplicationGraphNode_NetworkReplication::RefreshRouting()
+{
+	UNetworkReplicationSubsystem* Subsystem = GetSubsystem();
+	if (!Subsystem || Subsystem->GetRelevancyRevision() == LastRelevancyRevision)
+	{
+		return;
+	}
+
+	LastRelevancyRevision = Subsystem->GetRelevancyRevision();
+	const FNetworkReplicationSettings Settings = Subsystem->GetReplicationSettings();
+	bCachedRelevancyEnabled = Settings.bEnableRelevancy;
+	CachedCullDistance = Settings.MaxReplicationDistance;
+
+	// Pull every actor out and route it again so grid placement and cull distances follow the new settings
+	TArray<AActor*> Actors;
+	Actors.Reserve(ActorPlacements.Num());
+	for (const TPair<TObjectKey<AActor>, bool>& Pair : ActorPlacements)
+	{
+		if (AActor* Actor = Pair.Key.ResolveObjectPtr())
+		{
+			UnplaceActor(Actor, Pair.Value);
+			Actors.Add(Actor);
+		}
+	}
+
+	ActorPlacements.Reset();
+	for (AActor* Actor : Actors)
+	{
+		PlaceActor(Actor);
+	}
+}
+
+void UReplicationGraphNode_NetworkReplication::PlaceActor(AActor* Actor)
+{
+	const FNewReplicatedActorInfo ActorInfo(Actor);
+	UNetworkReplicationSubsystem* Subsystem = GetSubsystem();
+	const bool bUseGrid = GridNode && bCachedRelevancyEnabled && CachedCullDistance > 0.0f && !(Subsystem && Subsystem->IsInterestActor(Actor));
+
+	if (bUseGrid)
+	{
+		const float CullDistanceSquared = FMath::Square(CachedCullDistance);
+		FGlobalActorReplicationInfo& GlobalInfo = GraphGlobals->GlobalActorReplicationInfoMap->Get(Actor);
+		GlobalInfo.Settings.SetCullDistanceSquared(CullDistanceSquared);
+
+		// Connections that already know the actor cached the old distance when they first saw it
+		if (UReplicationGraph* Graph = GraphGlobals->ReplicationGraph)
+		{
+			for (UNetReplicationGraphConnection* ConnectionManager : Graph->Connections)
+			{
+				if (FConnectionReplicationActorInfo* ConnectionInfo = ConnectionManager ? ConnectionManager->ActorInfoMap.Find(Actor) : nullptr)
+				{
+					ConnectionInfo->SetCullDistanceSquared(CullDistanceSquared);
+				}
+			}
+		}
+
+		GridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
+	}
+	else
+	{
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+	}
+
+	ActorPlacements.Add(Actor, bUseGrid);
+}
+
+void UReplicationGraphNode_NetworkReplication::UnplaceActor(AActor* Actor, bool bInGrid)
+{
+	const FNewReplicatedActorInfo ActorInfo(Actor);
+	if (bInGrid && GridNode)
+	{
+		GridNode->RemoveActor_Dormancy(ActorInfo);
+	}
+	else
+	{
+		AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo, false);
+	}
+}
+
+// ===== SAMPLE REPLICATION GRAPH =====
+
+void UNetworkReplicationGraph::InitGlobalGraphNodes()
+{
+	Super::InitGlobalGraphNodes();
+
+	NetworkReplicationNode = CreateNewNode<UReplicationGraphNode_NetworkReplication>();
+	NetworkReplicationNode->SetGridNode(GridNode);
+	AddGlobalGraphNode(NetworkReplicationNode);
+}
+
+void UNetworkReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	if (ShouldRouteToNetworkReplicationNode(ActorInfo.Actor))
+	{
+		NetworkReplicationNode->NotifyAddNetworkActor(ActorInfo);
+		return;
+	}
+
+	Super::RouteAddNetworkActorToNodes(ActorInfo, GlobalInfo);
+}
+
+void UNetworkReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	if (NetworkReplicationNode->NotifyRemoveNetworkActor(ActorInfo, false))
+	{
+		return;
+	}
+
+	Super::RouteRemoveNetworkActorToNodes(ActorInfo);
+}
+
+bool UNetworkReplicationGraph::ShouldRouteToNetworkReplicationNode(const AActor* Actor)
+{
+	// Owner-only and always relevant actors need the per-connection handling of the basic graph
+	return Actor
+		&& !Actor->bAlwaysRelevant
+		&& !Actor->bOnlyRelevantToOwner
+		&& Actor->FindComponentByClass<UNetworkReplicationComponent>() != nullptr;
+}
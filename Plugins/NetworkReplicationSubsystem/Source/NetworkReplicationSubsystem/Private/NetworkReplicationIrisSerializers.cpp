@@ -0,0 +1,692 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationIrisSerializers.cpp
+// Implements and registers the Iris NetSerializers for the component's replicated hot joining and prediction state.
+
+#include "NetworkReplicationIrisSerializers.h"
+
+#if UE_WITH_IRIS
+
+#include "NetworkReplicationTypes.h"
+#include "Animation/AnimMontage.h"
+#include "Iris/ReplicationState/PropertyNetSerializerInfoRegistry.h"
+#include "Iris/Serialization/NetBitStreamReader.h"
+#include "Iris/Serialization/NetBitStreamUtil.h"
+#include "Iris/Serialization/NetBitStreamWriter.h"
+#include "Iris/Serialization/NetSerializationContext.h"
+#include "Iris/Serialization/NetSerializerDelegates.h"
+#include "Iris/Serialization/ObjectNetSerializer.h"
+#include "Iris/Serialization/StringNetSerializers.h"
+
+namespace UE::Net
+{
+
+// ===== FORWARDED MEMBERS =====
+
+namespace NetworkReplicationIris
+{
+	/** Holds the quantized state of an engine serializer, whose layout is private to IrisCore. Checked against the serializer at registration */
+	struct alignas(16) FForwardedState
+	{
+		uint8 Bytes[48];
+	};
+
+	static bool FitsForwardedState(const FNetSerializer& Serializer)
+	{
+		return Serializer.QuantizedTypeSize <= sizeof(FForwardedState) && Serializer.QuantizedTypeAlignment <= alignof(FForwardedState);
+	}
+
+	static void Serialize(FNetSerializationContext& Context, const FNetSerializer& Serializer, const FForwardedState& Source)
+	{
+		FNetSerializeArgs Args;
+		Args.Version = Serializer.Version;
+		Args.NetSerializerConfig = Serializer.DefaultConfig;
+		Args.Source = NetSerializerValuePointer(&Source);
+		Serializer.Serialize(Context, Args);
+	}
+
+	static void Deserialize(FNetSerializationContext& Context, const FNetSerializer& Serializer, FForwardedState& Target)
+	{
+		FNetDeserializeArgs Args;
+		Args.Version = Serializer.Version;
+		Args.NetSerializerConfig = Serializer.DefaultConfig;
+		Args.Target = NetSerializerValuePointer(&Target);
+		Serializer.Deserialize(Context, Args);
+	}
+
+	static void Quantize(FNetSerializationContext& Context, const FNetSerializer& Serializer, const void* Source, FForwardedState& Target)
+	{
+		FNetQuantizeArgs Args;
+		Args.Version = Serializer.Version;
+		Args.NetSerializerConfig = Serializer.DefaultConfig;
+		Args.Source = NetSerializerValuePointer(Source);
+		Args.Target = NetSerializerValuePointer(&Target);
+		Serializer.Quantize(Context, Args);
+	}
+
+	static void Dequantize(FNetSerializationContext& Context, const FNetSerializer& Serializer, const FForwardedState& Source, void* Target)
+	{
+		FNetDequantizeArgs Args;
+		Args.Version = Serializer.Version;
+		Args.NetSerializerConfig = Serializer.DefaultConfig;
+		Args.Source = NetSerializerValuePointer(&Source);
+		Args.Target = NetSerializerValuePointer(Target);
+		Serializer.Dequantize(Context, Args);
+	}
+
+	static bool IsEqual(FNetSerializationContext& Context, const FNetSerializer& Serializer, const void* Source0, const void* Source1, bool bStateIsQuantized)
+	{
+		FNetIsEqualArgs Args;
+		Args.Version = Serializer.Version;
+		Args.NetSerializerConfig = Serializer.DefaultConfig;
+		Args.Source0 = NetSerializerValuePointer(Source0);
+		Args.Source1 = NetSerializerValuePointer(Source1);
+		Args.bStateIsQuantized = bStateIsQuantized;
+		return Serializer.IsEqual(Context, Args);
+	}
+
+	static bool Validate(FNetSerializationContext& Context, const FNetSerializer& Serializer, const void* Source)
+	{
+		FNetValidateArgs Args;
+		Args.Version = Serializer.Version;
+		Args.NetSerializerConfig = Serializer.DefaultConfig;
+		Args.Source = NetSerializerValuePointer(Source);
+		return Serializer.Validate(Context, Args);
+	}
+
+	static void CloneDynamicState(FNetSerializationContext& Context, const FNetSerializer& Serializer, FForwardedState& Target, const FForwardedState& Source)
+	{
+		if (!EnumHasAnyFlags(Serializer.Traits, ENetSerializerTraits::HasDynamicState))
+		{
+			return;
+		}
+
+		FNetCloneDynamicStateArgs Args;
+		Args.Version = Serializer.Version;
+		Args.NetSerializerConfig = Serializer.DefaultConfig;
+		Args.Source = NetSerializerValuePointer(&Source);
+		Args.Target = NetSerializerValuePointer(&Target);
+		Serializer.CloneDynamicState(Context, Args);
+	}
+
+	static void FreeDynamicState(FNetSerializationContext& Context, const FNetSerializer& Serializer, FForwardedState& State)
+	{
+		if (!EnumHasAnyFlags(Serializer.Traits, ENetSerializerTraits::HasDynamicState))
+		{
+			return;
+		}
+
+		FNetFreeDynamicStateArgs Args;
+		Args.Version = Serializer.Version;
+		Args.NetSerializerConfig = Serializer.DefaultConfig;
+		Args.Source = NetSerializerValuePointer(&State);
+		Serializer.FreeDynamicState(Context, Args);
+	}
+
+	static void CollectNetReferences(FNetSerializationContext& Context, const FNetSerializer& Serializer, const FForwardedState& Source, const FNetCollectReferencesArgs& OuterArgs)
+	{
+		if (!EnumHasAnyFlags(Serializer.Traits, ENetSerializerTraits::HasCustomNetReference))
+		{
+			return;
+		}
+
+		FNetCollectReferencesArgs Args = OuterArgs;
+		Args.Version = Serializer.Version;
+		Args.NetSerializerConfig = Serializer.DefaultConfig;
+		Args.Source = NetSerializerValuePointer(&Source);
+		Serializer.CollectNetReferences(Context, Args);
+	}
+
+	static uint32 FloatToBits(float Value)
+	{
+		uint32 Bits = 0;
+		FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+		return Bits;
+	}
+
+	static float BitsToFloat(uint32 Bits)
+	{
+		float Value = 0.0f;
+		FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+		return Value;
+	}
+
+	static uint64 DoubleToBits(double Value)
+	{
+		uint64 Bits = 0;
+		FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+		return Bits;
+	}
+
+	static double BitsToDouble(uint64 Bits)
+	{
+		double Value = 0.0;
+		FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+		return Value;
+	}
+
+	/** Writes a float only when it differs from its default, which is what these fields hold almost all of the time */
+	static void WriteOptionalFloat(FNetBitStreamWriter* Writer, uint32 Bits, float DefaultValue)
+	{
+		if (Writer->WriteBool(Bits != FloatToBits(DefaultValue)))
+		{
+			Writer->WriteBits(Bits, 32U);
+		}
+	}
+
+	static uint32 ReadOptionalFloat(FNetBitStreamReader* Reader, float DefaultValue)
+	{
+		return Reader->ReadBool() ? Reader->ReadBits(32U) : FloatToBits(DefaultValue);
+	}
+
+	/** Relative locations are kept to a hundredth of a centimetre */
+	static constexpr double LocationScale = 100.0;
+}
+
+// ===== ATTACHMENT INFO =====
+
+struct FAttachmentInfoNetSerializer
+{
+	static constexpr uint32 Version = 0;
+	static constexpr bool bHasDynamicState = true;
+	static constexpr bool bHasCustomNetReference = true;
+
+	struct FQuantizedType
+	{
+		NetworkReplicationIris::FForwardedState Component;
+		NetworkReplicationIris::FForwardedState Owner;
+		NetworkReplicationIris::FForwardedState SocketName;
+		int32 Location[3];
+		uint16 Rotation[3];
+		uint32 Scale[3];
+		uint8 bKeepWorldTransform : 1;
+		uint8 bIsActive : 1;
+	};
+
+	typedef FAttachmentInfo SourceType;
+	typedef FQuantizedType QuantizedType;
+	typedef FAttachmentInfoNetSerializerConfig ConfigType;
+
+	static const ConfigType DefaultConfig;
+
+	static void Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args);
+	static void Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args);
+	static void Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args);
+	static void Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args);
+	static bool IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args);
+	static bool Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args);
+	static void CloneDynamicState(FNetSerializationContext& Context, const FNetCloneDynamicStateArgs& Args);
+	static void FreeDynamicState(FNetSerializationContext& Context, const FNetFreeDynamicStateArgs& Args);
+	static void CollectNetReferences(FNetSerializationContext& Context, const FNetCollectReferencesArgs& Args);
+
+	static const FNetSerializer& GetObjectSerializer() { return UE_NET_GET_SERIALIZER(FObjectPtrNetSerializer); }
+	static const FNetSerializer& GetNameSerializer() { return UE_NET_GET_SERIALIZER(FNameNetSerializer); }
+};
+UE_NET_IMPLEMENT_SERIALIZER(FAttachmentInfoNetSerializer);
+
+const FAttachmentInfoNetSerializer::ConfigType FAttachmentInfoNetSerializer::DefaultConfig;
+
+void FAttachmentInfoNetSerializer::Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args)
+{
+	const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+	FNetBitStreamWriter* Writer = Context.GetBitStreamWriter();
+
+	Writer->WriteBool(Source.bIsActive);
+	Writer->WriteBool(Source.bKeepWorldTransform);
+	NetworkReplicationIris::Serialize(Context, GetObjectSerializer(), Source.Component);
+	NetworkReplicationIris::Serialize(Context, GetObjectSerializer(), Source.Owner);
+	NetworkReplicationIris::Serialize(Context, GetNameSerializer(), Source.SocketName);
+
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		WritePackedInt32(Writer, Source.Location[Axis]);
+	}
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		Writer->WriteBits(Source.Rotation[Axis], 16U);
+	}
+
+	const bool bUnitScale = Source.Scale[0] == NetworkReplicationIris::FloatToBits(1.0f)
+		&& Source.Scale[1] == NetworkReplicationIris::FloatToBits(1.0f)
+		&& Source.Scale[2] == NetworkReplicationIris::FloatToBits(1.0f);
+	if (!Writer->WriteBool(bUnitScale))
+	{
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			Writer->WriteBits(Source.Scale[Axis], 32U);
+		}
+	}
+}
+
+void FAttachmentInfoNetSerializer::Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args)
+{
+	QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+	FNetBitStreamReader* Reader = Context.GetBitStreamReader();
+
+	Target.bIsActive = Reader->ReadBool();
+	Target.bKeepWorldTransform = Reader->ReadBool();
+	NetworkReplicationIris::Deserialize(Context, GetObjectSerializer(), Target.Component);
+	NetworkReplicationIris::Deserialize(Context, GetObjectSerializer(), Target.Owner);
+	NetworkReplicationIris::Deserialize(Context, GetNameSerializer(), Target.SocketName);
+
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		Target.Location[Axis] = ReadPackedInt32(Reader);
+	}
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		Target.Rotation[Axis] = static_cast<uint16>(Reader->ReadBits(16U));
+	}
+
+	const bool bUnitScale = Reader->ReadBool();
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		Target.Scale[Axis] = bUnitScale ? NetworkReplicationIris::FloatToBits(1.0f) : Reader->ReadBits(32U);
+	}
+}
+
+void FAttachmentInfoNetSerializer::Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args)
+{
+	const SourceType& Source = *reinterpret_cast<const SourceType*>(Args.Source);
+	QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+
+	Target.bIsActive = Source.bIsActive;
+	Target.bKeepWorldTransform = Source.bKeepWorldTransform;
+	NetworkReplicationIris::Quantize(Context, GetObjectSerializer(), &Source.Component, Target.Component);
+	NetworkReplicationIris::Quantize(Context, GetObjectSerializer(), &Source.Owner, Target.Owner);
+	NetworkReplicationIris::Quantize(Context, GetNameSerializer(), &Source.SocketName, Target.SocketName);
+
+	const FVector Location = Source.RelativeTransform.GetLocation();
+	const FRotator Rotation = Source.RelativeTransform.Rotator();
+	const FVector Scale = Source.RelativeTransform.GetScale3D();
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		Target.Location[Axis] = static_cast<int32>(FMath::Clamp(FMath::RoundToDouble(Location[Axis] * NetworkReplicationIris::LocationScale), static_cast<double>(MIN_int32), static_cast<double>(MAX_int32)));
+		Target.Scale[Axis] = NetworkReplicationIris::FloatToBits(static_cast<float>(Scale[Axis]));
+	}
+	Target.Rotation[0] = FRotator::CompressAxisToShort(Rotation.Pitch);
+	Target.Rotation[1] = FRotator::CompressAxisToShort(Rotation.Yaw);
+	Target.Rotation[2] = FRotator::CompressAxisToShort(Rotation.Roll);
+}
+
+void FAttachmentInfoNetSerializer::Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args)
+{
+	const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+	SourceType& Target = *reinterpret_cast<SourceType*>(Args.Target);
+
+	Target.bIsActive = Source.bIsActive;
+	Target.bKeepWorldTransform = Source.bKeepWorldTransform;
+	NetworkReplicationIris::Dequantize(Context, GetObjectSerializer(), Source.Component, &Target.Component);
+	NetworkReplicationIris::Dequantize(Context, GetObjectSerializer(), Source.Owner, &Target.Owner);
+	NetworkReplicationIris::Dequantize(Context, GetNameSerializer(), Source.SocketName, &Target.SocketName);
+
+	const FVector Location(
+		Source.Location[0] / NetworkReplicationIris::LocationScale,
+		Source.Location[1] / NetworkReplicationIris::LocationScale,
+		Source.Location[2] / NetworkReplicationIris::LocationScale);
+	const FRotator Rotation(
+		FRotator::DecompressAxisFromShort(Source.Rotation[0]),
+		FRotator::DecompressAxisFromShort(Source.Rotation[1]),
+		FRotator::DecompressAxisFromShort(Source.Rotation[2]));
+	const FVector Scale(
+		NetworkReplicationIris::BitsToFloat(Source.Scale[0]),
+		NetworkReplicationIris::BitsToFloat(Source.Scale[1]),
+		NetworkReplicationIris::BitsToFloat(Source.Scale[2]));
+	Target.RelativeTransform = FTransform(Rotation, Location, Scale);
+}
+
+bool FAttachmentInfoNetSerializer::IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args)
+{
+	if (Args.bStateIsQuantized)
+	{
+		const QuantizedType& Value0 = *reinterpret_cast<const QuantizedType*>(Args.Source0);
+		const QuantizedType& Value1 = *reinterpret_cast<const QuantizedType*>(Args.Source1);
+
+		return Value0.bIsActive == Value1.bIsActive
+			&& Value0.bKeepWorldTransform == Value1.bKeepWorldTransform
+			&& FMemory::Memcmp(Value0.Location, Value1.Location, sizeof(Value0.Location)) == 0
+			&& FMemory::Memcmp(Value0.Rotation, Value1.Rotation, sizeof(Value0.Rotation)) == 0
+			&& FMemory::Memcmp(Value0.Scale, Value1.Scale, sizeof(Value0.Scale)) == 0
+			&& NetworkReplicationIris::IsEqual(Context, GetObjectSerializer(), &Value0.Component, &Value1.Component, true)
+			&& NetworkReplicationIris::IsEqual(Context, GetObjectSerializer(), &Value0.Owner, &Value1.Owner, true)
+			&& NetworkReplicationIris::IsEqual(Context, GetNameSerializer(), &Value0.SocketName, &Value1.SocketName, true);
+	}
+
+	const SourceType& Value0 = *reinterpret_cast<const SourceType*>(Args.Source0);
+	const SourceType& Value1 = *reinterpret_cast<const SourceType*>(Args.Source1);
+
+	return Value0.bIsActive == Value1.bIsActive
+		&& Value0.bKeepWorldTransform == Value1.bKeepWorldTransform
+		&& Value0.Component == Value1.Component
+		&& Value0.Owner == Value1.Owner
+		&& Value0.SocketName == Value1.SocketName
+		&& Value0.RelativeTransform.Equals(Value1.RelativeTransform, 0.0);
+}
+
+bool FAttachmentInfoNetSerializer::Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args)
+{
+	const SourceType& Source = *reinterpret_cast<const SourceType*>(Args.Source);
+
+	return !Source.RelativeTransform.ContainsNaN()
+		&& NetworkReplicationIris::Validate(Context, GetObjectSerializer(), &Source.Component)
+		&& NetworkReplicationIris::Validate(Context, GetObjectSerializer(), &Source.Owner)
+		&& NetworkReplicationIris::Validate(Context, GetNameSerializer(), &Source.SocketName);
+}
+
+void FAttachmentInfoNetSerializer::CloneDynamicState(FNetSerializationContext& Context, const FNetCloneDynamicStateArgs& Args)
+{
+	const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+	QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+
+	NetworkReplicationIris::CloneDynamicState(Context, GetObjectSerializer(), Target.Component, Source.Component);
+	NetworkReplicationIris::CloneDynamicState(Context, GetObjectSerializer(), Target.Owner, Source.Owner);
+	NetworkReplicationIris::CloneDynamicState(Context, GetNameSerializer(), Target.SocketName, Source.SocketName);
+}
+
+void FAttachmentInfoNetSerializer::FreeDynamicState(FNetSerializationContext& Context, const FNetFreeDynamicStateArgs& Args)
+{
+	QuantizedType& Source = *reinterpret_cast<QuantizedType*>(Args.Source);
+
+	NetworkReplicationIris::FreeDynamicState(Context, GetObjectSerializer(), Source.Component);
+	NetworkReplicationIris::FreeDynamicState(Context, GetObjectSerializer(), Source.Owner);
+	NetworkReplicationIris::FreeDynamicState(Context, GetNameSerializer(), Source.SocketName);
+}
+
+void FAttachmentInfoNetSerializer::CollectNetReferences(FNetSerializationContext& Context, const FNetCollectReferencesArgs& Args)
+{
+	const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+
+	NetworkReplicationIris::CollectNetReferences(Context, GetObjectSerializer(), Source.Component, Args);
+	NetworkReplicationIris::CollectNetReferences(Context, GetObjectSerializer(), Source.Owner, Args);
+}
+
+// ===== PREDICTION STATE =====
+
+struct FPredictionStateNetSerializer
+{
+	static constexpr uint32 Version = 0;
+
+	struct FQuantizedType
+	{
+		uint64 ClientSendTime;
+		int32 InputFrame;
+		uint32 CorrectionFactor;
+		uint8 bIsPredicting;
+	};
+
+	typedef FPredictionState SourceType;
+	typedef FQuantizedType QuantizedType;
+	typedef FPredictionStateNetSerializerConfig ConfigType;
+
+	static const ConfigType DefaultConfig;
+
+	static void Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args);
+	static void Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args);
+	static void Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args);
+	static void Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args);
+	static bool IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args);
+	static bool Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args);
+};
+UE_NET_IMPLEMENT_SERIALIZER(FPredictionStateNetSerializer);
+
+const FPredictionStateNetSerializer::ConfigType FPredictionStateNetSerializer::DefaultConfig;
+
+void FPredictionStateNetSerializer::Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args)
+{
+	const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+	FNetBitStreamWriter* Writer = Context.GetBitStreamWriter();
+
+	Writer->WriteBool(Source.bIsPredicting != 0);
+	WriteUint64(Writer, Source.ClientSendTime);
+	WritePackedInt32(Writer, Source.InputFrame);
+	NetworkReplicationIris::WriteOptionalFloat(Writer, Source.CorrectionFactor, 1.0f);
+}
+
+void FPredictionStateNetSerializer::Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args)
+{
+	QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+	FNetBitStreamReader* Reader = Context.GetBitStreamReader();
+
+	Target.bIsPredicting = Reader->ReadBool() ? 1U : 0U;
+	Target.ClientSendTime = ReadUint64(Reader);
+	Target.InputFrame = ReadPackedInt32(Reader);
+	Target.CorrectionFactor = NetworkReplicationIris::ReadOptionalFloat(Reader, 1.0f);
+}
+
+void FPredictionStateNetSerializer::Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args)
+{
+	const SourceType& Source = *reinterpret_cast<const SourceType*>(Args.Source);
+	QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+
+	Target.ClientSendTime = NetworkReplicationIris::DoubleToBits(Source.ClientSendTime);
+	Target.InputFrame = Source.InputFrame;
+	Target.CorrectionFactor = NetworkReplicationIris::FloatToBits(Source.CorrectionFactor);
+	Target.bIsPredicting = Source.bIsPredicting ? 1U : 0U;
+}
+
+void FPredictionStateNetSerializer::Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args)
+{
+	const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+	SourceType& Target = *reinterpret_cast<SourceType*>(Args.Target);
+
+	Target.ClientSendTime = NetworkReplicationIris::BitsToDouble(Source.ClientSendTime);
+	Target.InputFrame = Source.InputFrame;
+	Target.CorrectionFactor = NetworkReplicationIris::BitsToFloat(Source.CorrectionFactor);
+	Target.bIsPredicting = Source.bIsPredicting != 0;
+}
+
+bool FPredictionStateNetSerializer::IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args)
+{
+	if (Args.bStateIsQuantized)
+	{
+		const QuantizedType& Value0 = *reinterpret_cast<const QuantizedType*>(Args.Source0);
+		const QuantizedType& Value1 = *reinterpret_cast<const QuantizedType*>(Args.Source1);
+
+		return Value0.ClientSendTime == Value1.ClientSendTime
+			&& Value0.InputFrame == Value1.InputFrame
+			&& Value0.CorrectionFactor == Value1.CorrectionFactor
+			&& Value0.bIsPredicting == Value1.bIsPredicting;
+	}
+
+	const SourceType& Value0 = *reinterpret_cast<const SourceType*>(Args.Source0);
+	const SourceType& Value1 = *reinterpret_cast<const SourceType*>(Args.Source1);
+
+	return Value0.ClientSendTime == Value1.ClientSendTime
+		&& Value0.InputFrame == Value1.InputFrame
+		&& Value0.CorrectionFactor == Value1.CorrectionFactor
+		&& Value0.bIsPredicting == Value1.bIsPredicting;
+}
+
+bool FPredictionStateNetSerializer::Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args)
+{
+	const SourceType& Source = *reinterpret_cast<const SourceType*>(Args.Source);
+	return FMath::IsFinite(Source.ClientSendTime) && FMath::IsFinite(Source.CorrectionFactor);
+}
+
+// ===== ANIMATION PREDICTION DATA =====
+
+struct FAnimationPredictionDataNetSerializer
+{
+	static constexpr uint32 Version = 0;
+	static constexpr bool bHasDynamicState = true;
+	static constexpr bool bHasCustomNetReference = true;
+
+	struct FQuantizedType
+	{
+		NetworkReplicationIris::FForwardedState Montage;
+		uint64 PredictionTime;
+		uint32 PlayRate;
+		uint32 StartingPosition;
+		uint8 bIsValid;
+	};
+
+	typedef FAnimationPredictionData SourceType;
+	typedef FQuantizedType QuantizedType;
+	typedef FAnimationPredictionDataNetSerializerConfig ConfigType;
+
+	static const ConfigType DefaultConfig;
+
+	static void Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args);
+	static void Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args);
+	static void Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args);
+	static void Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args);
+	static bool IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args);
+	static bool Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args);
+	static void CloneDynamicState(FNetSerializationContext& Context, const FNetCloneDynamicStateArgs& Args);
+	static void FreeDynamicState(FNetSerializationContext& Context, const FNetFreeDynamicStateArgs& Args);
+	static void CollectNetReferences(FNetSerializationContext& Context, const FNetCollectReferencesArgs& Args);
+
+	static const FNetSerializer& GetObjectSerializer() { return UE_NET_GET_SERIALIZER(FObjectPtrNetSerializer); }
+};
+UE_NET_IMPLEMENT_SERIALIZER(FAnimationPredictionDataNetSerializer);
+
+const FAnimationPredictionDataNetSerializer::ConfigType FAnimationPredictionDataNetSerializer::DefaultConfig;
+
+void FAnimationPredictionDataNetSerializer::Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args)
+{
+	const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+	FNetBitStreamWriter* Writer = Context.GetBitStreamWriter();
+
+	Writer->WriteBool(Source.bIsValid != 0);
+	NetworkReplicationIris::Serialize(Context, GetObjectSerializer(), Source.Montage);
+	WriteUint64(Writer, Source.PredictionTime);
+	NetworkReplicationIris::WriteOptionalFloat(Writer, Source.PlayRate, 1.0f);
+	NetworkReplicationIris::WriteOptionalFloat(Writer, Source.StartingPosition, 0.0f);
+}
+
+void FAnimationPredictionDataNetSerializer::Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args)
+{
+	QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+	FNetBitStreamReader* Reader = Context.GetBitStreamReader();
+
+	Target.bIsValid = Reader->ReadBool() ? 1U : 0U;
+	NetworkReplicationIris::Deserialize(Context, GetObjectSerializer(), Target.Montage);
+	Target.PredictionTime = ReadUint64(Reader);
+	Target.PlayRate = NetworkReplicationIris::ReadOptionalFloat(Reader, 1.0f);
+	Target.StartingPosition = NetworkReplicationIris::ReadOptionalFloat(Reader, 0.0f);
+}
+
+void FAnimationPredictionDataNetSerializer::Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args)
+{
+	const SourceType& Source = *reinterpret_cast<const SourceType*>(Args.Source);
+	QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+
+	NetworkReplicationIris::Quantize(Context, GetObjectSerializer(), &Source.Montage, Target.Montage);
+	Target.PredictionTime = NetworkReplicationIris::DoubleToBits(Source.PredictionTime);
+	Target.PlayRate = NetworkReplicationIris::FloatToBits(Source.PlayRate);
+	Target.StartingPosition = NetworkReplicationIris::FloatToBits(Source.StartingPosition);
+	Target.bIsValid = Source.bIsValid ? 1U : 0U;
+}
+
+void FAnimationPredictionDataNetSerializer::Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args)
+{
+	const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+	SourceType& Target = *reinterpret_cast<SourceType*>(Args.Target);
+
+	NetworkReplicationIris::Dequantize(Context, GetObjectSerializer(), Source.Montage, &Target.Montage);
+	Target.PredictionTime = NetworkReplicationIris::BitsToDouble(Source.PredictionTime);
+	Target.PlayRate = NetworkReplicationIris::BitsToFloat(Source.PlayRate);
+	Target.StartingPosition = NetworkReplicationIris::BitsToFloat(Source.StartingPosition);
+	Target.bIsValid = Source.bIsValid != 0;
+}
+
+bool FAnimationPredictionDataNetSerializer::IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args)
+{
+	if (Args.bStateIsQuantized)
+	{
+		const QuantizedType& Value0 = *reinterpret_cast<const QuantizedType*>(Args.Source0);
+		const QuantizedType& Value1 = *reinterpret_cast<const QuantizedType*>(Args.Source1);
+
+		return Value0.bIsValid == Value1.bIsValid
+			&& Value0.PredictionTime == Value1.PredictionTime
+			&& Value0.PlayRate == Value1.PlayRate
+			&& Value0.StartingPosition == Value1.StartingPosition
+			&& NetworkReplicationIris::IsEqual(Context, GetObjectSerializer(), &Value0.Montage, &Value1.Montage, true);
+	}
+
+	const SourceType& Value0 = *reinterpret_cast<const SourceType*>(Args.Source0);
+	const SourceType& Value1 = *reinterpret_cast<const SourceType*>(Args.Source1);
+
+	return Value0.bIsValid == Value1.bIsValid
+		&& Value0.Montage == Value1.Montage
+		&& Value0.PredictionTime == Value1.PredictionTime
+		&& Value0.PlayRate == Value1.PlayRate
+		&& Value0.StartingPosition == Value1.StartingPosition;
+}
+
+bool FAnimationPredictionDataNetSerializer::Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args)
+{
+	const SourceType& Source = *reinterpret_cast<const SourceType*>(Args.Source);
+
+	return FMath::IsFinite(Source.PredictionTime)
+		&& FMath::IsFinite(Source.PlayRate)
+		&& FMath::IsFinite(Source.StartingPosition)
+		&& NetworkReplicationIris::Validate(Context, GetObjectSerializer(), &Source.Montage);
+}
+
+void FAnimationPredictionDataNetSerializer::CloneDynamicState(FNetSerializationContext& Context, const FNetCloneDynamicStateArgs& Args)
+{
+	const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+	QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+	NetworkReplicationIris::CloneDynamicState(Context, GetObjectSerializer(), Target.Montage, Source.Montage);
+}
+
+void FAnimationPredictionDataNetSerializer::FreeDynamicState(FNetSerializationContext& Context, const FNetFreeDynamicStateArgs& Args)
+{
+	QuantizedType& Source = *reinterpret_cast<QuantizedType*>(Args.Source);
+	NetworkReplicationIris::FreeDynamicState(Context, GetObjectSerializer(), Source.Montage);
+}
+
+void FAnimationPredictionDataNetSerializer::CollectNetReferences(FNetSerializationContext& Context, const FNetCollectReferencesArgs& Args)
+{
+	const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+	NetworkReplicationIris::CollectNetReferences(Context, GetObjectSerializer(), Source.Montage, Args);
+}
+
+// ===== REGISTRATION =====
+
+static const FName PropertyNetSerializerRegistry_NAME_AttachmentInfo("AttachmentInfo");
+UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_AttachmentInfo, FAttachmentInfoNetSerializer);
+
+static const FName PropertyNetSerializerRegistry_NAME_PredictionState("PredictionState");
+UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_PredictionState, FPredictionStateNetSerializer);
+
+static const FName PropertyNetSerializerRegistry_NAME_AnimationPredictionData("AnimationPredictionData");
+UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_AnimationPredictionData, FAnimationPredictionDataNetSerializer);
+
+class FNetworkReplicationNetSerializerRegistryDelegates final : private FNetSerializerRegistryDelegates
+{
+public:
+	virtual ~FNetworkReplicationNetSerializerRegistryDelegates();
+
+private:
+	virtual void OnPreFreezeNetSerializerRegistry() override;
+};
+
+static FNetworkReplicationNetSerializerRegistryDelegates NetworkReplicationNetSerializerRegistryDelegates;
+
+FNetworkReplicationNetSerializerRegistryDelegates::~FNetworkReplicationNetSerializerRegistryDelegates()
+{
+	UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_AttachmentInfo);
+	UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_PredictionState);
+	UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_AnimationPredictionData);
+}
+
+void FNetworkReplicationNetSerializerRegistryDelegates::OnPreFreezeNetSerializerRegistry()
+{
+	// The forwarded engine serializers must fit the opaque storage in our quantized types
+	if (!NetworkReplicationIris::FitsForwardedState(UE_NET_GET_SERIALIZER(FObjectPtrNetSerializer))
+		|| !NetworkReplicationIris::FitsForwardedState(UE_NET_GET_SERIALIZER(FNameNetSerializer)))
+	{
+		UE_LOG(LogTemp, Error, TEXT("NetworkReplication Iris serializers not registered: engine quantized state no longer fits FForwardedState"));
+		return;
+	}
+
+	UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_AttachmentInfo);
+	UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_PredictionState);
+	UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_AnimationPredictionData);
+}
+
+}
+
+#endif // UE_WITH_IRIS
@@ -0,0 +1,74 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationNameTable.cpp
+// Implements ANetworkReplicationNameTable, the replicated carrier for the session name dictionary.
+
+#include "NetworkReplicationNameTable.h"
+#include "NetworkReplicationSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Net/UnrealNetwork.h"
+
+void FNetworkReplicationNameEntry::PostReplicatedAdd(const FNetworkReplicationNameArray& InArraySerializer)
+{
+	if (InArraySerializer.OwnerTable)
+	{
+		InArraySerializer.OwnerTable->HandleEntryReceived(Id, Name);
+	}
+}
+
+ANetworkReplicationNameTable::ANetworkReplicationNameTable()
+{
+	bReplicates = true;
+	bAlwaysRelevant = true;
+
+	// Entries are pushed with ForceNetUpdate, so the table does not need frequent polling
+	SetNetUpdateFrequency(1.0f);
+
+	Entries.OwnerTable = this;
+}
+
+void ANetworkReplicationNameTable::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	// A fresh table on a client means a new session; drop ids learned from any previous server
+	if (!HasAuthority())
+	{
+		if (UGameInstance* GameInstance = GetGameInstance())
+		{
+			if (UNetworkReplicationSubsystem* Subsystem = GameInstance->GetSubsystem<UNetworkReplicationSubsystem>())
+			{
+				Subsystem->ResetReplicatedNames();
+			}
+		}
+	}
+}
+
+void ANetworkReplicationNameTable::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ANetworkReplicationNameTable, Entries);
+}
+
+void ANetworkReplicationNameTable::AddEntry(int32 Id, FName Name)
+{
+	FNetworkReplicationNameEntry& Entry = Entries.Items.AddDefaulted_GetRef();
+	Entry.Id = Id;
+	Entry.Name = Name;
+	Entries.MarkItemDirty(Entry);
+
+	ForceNetUpdate();
+}
+
+void ANetworkReplicationNameTable::HandleEntryReceived(int32 Id, FName Name)
+{
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		if (UNetworkReplicationSubsystem* Subsystem = GameInstance->GetSubsystem<UNetworkReplicationSubsystem>())
+		{
+			Subsystem->RegisterReplicatedName(Id, Name);
+		}
+	}
+}
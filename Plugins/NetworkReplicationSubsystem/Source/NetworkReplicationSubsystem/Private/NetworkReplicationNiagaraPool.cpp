@@ -0,0 +1,183 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationNiagaraPool.cpp
+// Implements the per-world Niagara component pool used by replicated effects.
+
+#include "NetworkReplicationNiagaraPool.h"
+#include "NetworkReplicationSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+
+bool UNetworkReplicationNiagaraPool::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Dedicated servers never play cosmetics, so there is nothing to pool
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+bool UNetworkReplicationNiagaraPool::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UNetworkReplicationNiagaraPool::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	UGameInstance* GameInstance = InWorld.GetGameInstance();
+	UNetworkReplicationSubsystem* Subsystem = GameInstance ? GameInstance->GetSubsystem<UNetworkReplicationSubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	for (const TPair<TSoftObjectPtr<UNiagaraSystem>, int32>& Pair : Subsystem->GetNiagaraPoolPrewarm())
+	{
+		if (UNiagaraSystem* Effect = Pair.Key.LoadSynchronous())
+		{
+			Prewarm(Effect, Pair.Value);
+		}
+	}
+}
+
+void UNetworkReplicationNiagaraPool::Deinitialize()
+{
+	EmptyPool();
+	Super::Deinitialize();
+}
+
+UNiagaraComponent* UNetworkReplicationNiagaraPool::Acquire(UNiagaraSystem* Effect)
+{
+	if (!Effect)
+	{
+		return nullptr;
+	}
+
+	FNetworkReplicationNiagaraPoolEntry& Entry = Pools.FindOrAdd(Effect);
+
+	// Components destroyed from outside, for example by a level transition, are skipped
+	while (Entry.Idle.Num() > 0)
+	{
+		UNiagaraComponent* Component = Entry.Idle.Pop(EAllowShrinking::No);
+		NumIdle--;
+		if (IsValid(Component))
+		{
+			Entry.Live.Add(Component);
+			NumLive++;
+			Hits++;
+			return Component;
+		}
+	}
+
+	NumLive -= Entry.Live.RemoveAll([](const TObjectPtr<UNiagaraComponent>& Component) { return !IsValid(Component); });
+	if (Entry.Live.Num() < GetMaxPerSystem())
+	{
+		UNiagaraComponent* Component = CreatePooledComponent(Effect);
+		Entry.Live.Add(Component);
+		NumLive++;
+		Misses++;
+		return Component;
+	}
+
+	// At the cap, cut the oldest effect short rather than allocate; it leaves Live first so its finish event is ignored
+	UNiagaraComponent* Component = Entry.Live[0];
+	Entry.Live.RemoveAt(0, EAllowShrinking::No);
+	Component->DeactivateImmediate();
+	if (Component->GetAttachParent())
+	{
+		Component->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	}
+	Entry.Live.Add(Component);
+	Recycled++;
+	return Component;
+}
+
+void UNetworkReplicationNiagaraPool::Prewarm(UNiagaraSystem* Effect, int32 Count)
+{
+	if (!Effect || !GetWorld())
+	{
+		return;
+	}
+
+	FNetworkReplicationNiagaraPoolEntry& Entry = Pools.FindOrAdd(Effect);
+	const int32 MaxPerSystem = GetMaxPerSystem();
+	while (Entry.Idle.Num() < Count && Entry.Idle.Num() + Entry.Live.Num() < MaxPerSystem)
+	{
+		Entry.Idle.Add(CreatePooledComponent(Effect));
+		NumIdle++;
+	}
+}
+
+void UNetworkReplicationNiagaraPool::EmptyPool()
+{
+	auto DestroyComponents = [this](const TArray<TObjectPtr<UNiagaraComponent>>& Components)
+	{
+		for (UNiagaraComponent* Component : Components)
+		{
+			if (IsValid(Component))
+			{
+				Component->OnSystemFinished.RemoveAll(this);
+				Component->DestroyComponent();
+			}
+		}
+	};
+
+	for (TPair<TObjectPtr<UNiagaraSystem>, FNetworkReplicationNiagaraPoolEntry>& Pair : Pools)
+	{
+		DestroyComponents(Pair.Value.Idle);
+		DestroyComponents(Pair.Value.Live);
+	}
+
+	Pools.Empty();
+	NumLive = 0;
+	NumIdle = 0;
+}
+
+void UNetworkReplicationNiagaraPool::GetPoolStats(int32& OutLive, int32& OutIdle, int64& OutHits, int64& OutMisses, int64& OutRecycled) const
+{
+	OutLive = NumLive;
+	OutIdle = NumIdle;
+	OutHits = Hits;
+	OutMisses = Misses;
+	OutRecycled = Recycled;
+}
+
+UNiagaraComponent* UNetworkReplicationNiagaraPool::CreatePooledComponent(UNiagaraSystem* Effect)
+{
+	UWorld* World = GetWorld();
+	UNiagaraComponent* Component = NewObject<UNiagaraComponent>(World);
+	Component->SetAutoActivate(false);
+	Component->SetAutoDestroy(false);
+	Component->SetAsset(Effect);
+	Component->OnSystemFinished.AddUniqueDynamic(this, &UNetworkReplicationNiagaraPool::OnPooledComponentFinished);
+	Component->RegisterComponentWithWorld(World);
+	return Component;
+}
+
+int32 UNetworkReplicationNiagaraPool::GetMaxPerSystem() const
+{
+	UWorld* World = GetWorld();
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	const UNetworkReplicationSubsystem* Subsystem = GameInstance ? GameInstance->GetSubsystem<UNetworkReplicationSubsystem>() : nullptr;
+	return Subsystem ? FMath::Max(Subsystem->GetNiagaraPoolMaxPerSystem(), 1) : 32;
+}
+
+void UNetworkReplicationNiagaraPool::OnPooledComponentFinished(UNiagaraComponent* Component)
+{
+	FNetworkReplicationNiagaraPoolEntry* Entry = Component ? Pools.Find(Component->GetAsset()) : nullptr;
+	if (!Entry || Entry->Live.RemoveSingle(Component) == 0)
+	{
+		return;
+	}
+
+	// Attached effects are released where they finished so a later owner can place them
+	if (Component->GetAttachParent())
+	{
+		Component->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	}
+
+	NumLive--;
+	Entry->Idle.Add(Component);
+	NumIdle++;
+}
@@ -0,0 +1,18 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationQuantizationProfile.cpp
+// Implements rule lookup for UNetworkReplicationQuantizationProfile.
+
+#include "NetworkReplicationQuantizationProfile.h"
+
+const FReplicationQuantizationRule* UNetworkReplicationQuantizationProfile::FindVariableRule(FName VariableName) const
+{
+	const FReplicationQuantizationRule* Rule = VariableRules.Find(VariableName);
+	return Rule && Rule->Mode != EReplicationQuantizationMode::None ? Rule : nullptr;
+}
+
+const FReplicationQuantizationRule* UNetworkReplicationQuantizationProfile::FindEventRule(EReplicationQuantizedField Field) const
+{
+	const FReplicationQuantizationRule* Rule = EventRules.Find(Field);
+	return Rule && Rule->Mode != EReplicationQuantizationMode::None ? Rule : nullptr;
+}
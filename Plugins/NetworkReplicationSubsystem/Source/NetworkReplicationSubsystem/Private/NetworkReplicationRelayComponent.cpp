@@ -0,0 +1,42 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationRelayComponent.cpp
+// Implements the per-connection relay that hands fanned out events to their source component.
+
+#include "NetworkReplicationRelayComponent.h"
+#include "NetworkReplicationComponent.h"
+#include "NiagaraSystem.h"
+#include "Sound/SoundBase.h"
+
+UNetworkReplicationRelayComponent::UNetworkReplicationRelayComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	SetIsReplicatedByDefault(true);
+}
+
+void UNetworkReplicationRelayComponent::ClientPlaySoundAtLocation_Implementation(UNetworkReplicationComponent* Source, USoundBase* Sound, const FQuantizedValue& Location, float VolumeMultiplier, float PitchMultiplier, float StartTime)
+{
+	// Null when the source's actor is not relevant here, and then nobody is listening for it
+	if (Source)
+	{
+		Source->MulticastPlaySoundAtLocation_Implementation(Sound, Location, VolumeMultiplier, PitchMultiplier, StartTime);
+	}
+}
+
+void UNetworkReplicationRelayComponent::ClientSpawnNiagaraEffect_Implementation(UNetworkReplicationComponent* Source, UNiagaraSystem* Effect, FVector Location, FRotator Rotation)
+{
+	if (Source)
+	{
+		Source->MulticastSpawnNiagaraEffect_Implementation(Effect, Location, Rotation, false, NAME_None);
+	}
+}
+
+void UNetworkReplicationRelayComponent::ClientPlaySoundAtLocationUnreliable_Implementation(UNetworkReplicationComponent* Source, USoundBase* Sound, const FQuantizedValue& Location, float VolumeMultiplier, float PitchMultiplier, float StartTime)
+{
+	ClientPlaySoundAtLocation_Implementation(Source, Sound, Location, VolumeMultiplier, PitchMultiplier, StartTime);
+}
+
+void UNetworkReplicationRelayComponent::ClientSpawnNiagaraEffectUnreliable_Implementation(UNetworkReplicationComponent* Source, UNiagaraSystem* Effect, FVector Location, FRotator Rotation)
+{
+	ClientSpawnNiagaraEffect_Implementation(Source, Effect, Location, Rotation);
+}
@@ -0,0 +1,170 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationSpatialGrid.cpp
+// Implements the uniform spatial hash used for interest management queries.
+
+#include "NetworkReplicationSpatialGrid.h"
+#include "GameFramework/Actor.h"
+
+FNetworkReplicationSpatialGrid::FNetworkReplicationSpatialGrid(float InCellSize)
+	: CellSize(FMath::Max(InCellSize, 1.0f))
+{
+}
+
+void FNetworkReplicationSpatialGrid::SetCellSize(float InCellSize)
+{
+	const float NewCellSize = FMath::Max(InCellSize, 1.0f);
+	if (NewCellSize == CellSize)
+	{
+		return;
+	}
+
+	CellSize = NewCellSize;
+	Cells.Reset();
+	for (int32 Handle = 0; Handle < Entries.Num(); Handle++)
+	{
+		if (Entries[Handle].bInUse)
+		{
+			Entries[Handle].Cell = GetCell(Entries[Handle].Location);
+			LinkToCell(Handle);
+		}
+	}
+}
+
+int32 FNetworkReplicationSpatialGrid::Add(AActor* Actor, const FVector& Location)
+{
+	const int32 Handle = FreeHandles.Num() > 0 ? FreeHandles.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+
+	FEntry& Entry = Entries[Handle];
+	Entry.Actor = Actor;
+	Entry.Location = Location;
+	Entry.Cell = GetCell(Location);
+	Entry.bInUse = true;
+	LinkToCell(Handle);
+
+	NumEntries++;
+	return Handle;
+}
+
+void FNetworkReplicationSpatialGrid::Remove(int32 Handle)
+{
+	if (!IsValidHandle(Handle))
+	{
+		return;
+	}
+
+	UnlinkFromCell(Handle);
+	Entries[Handle] = FEntry();
+	FreeHandles.Add(Handle);
+	NumEntries--;
+}
+
+void FNetworkReplicationSpatialGrid::Move(int32 Handle, const FVector& Location)
+{
+	if (!IsValidHandle(Handle))
+	{
+		return;
+	}
+
+	FEntry& Entry = Entries[Handle];
+	Entry.Location = Location;
+
+	const FIntPoint NewCell = GetCell(Location);
+	if (NewCell != Entry.Cell)
+	{
+		UnlinkFromCell(Handle);
+		Entry.Cell = NewCell;
+		LinkToCell(Handle);
+	}
+}
+
+void FNetworkReplicationSpatialGrid::QueryRadius(const FVector& Center, float Radius, TArray<int32>& OutHandles) const
+{
+	const double RadiusSquared = FMath::Square(static_cast<double>(Radius));
+	const FIntPoint MinCell = GetCell(Center - FVector(Radius, Radius, 0.0));
+	const FIntPoint MaxCell = GetCell(Center + FVector(Radius, Radius, 0.0));
+
+	auto GatherCell = [&](const TArray<int32>& CellHandles)
+	{
+		for (int32 Handle : CellHandles)
+		{
+			if (FVector::DistSquared(Entries[Handle].Location, Center) <= RadiusSquared)
+			{
+				OutHandles.Add(Handle);
+			}
+		}
+	};
+
+	// A radius much larger than the populated area is cheaper to answer by walking the occupied cells
+	const int64 NumCellsInRange = static_cast<int64>(MaxCell.X - MinCell.X + 1) * static_cast<int64>(MaxCell.Y - MinCell.Y + 1);
+	if (NumCellsInRange > Cells.Num())
+	{
+		for (const TPair<FIntPoint, TArray<int32>>& Pair : Cells)
+		{
+			if (Pair.Key.X >= MinCell.X && Pair.Key.X <= MaxCell.X && Pair.Key.Y >= MinCell.Y && Pair.Key.Y <= MaxCell.Y)
+			{
+				GatherCell(Pair.Value);
+			}
+		}
+		return;
+	}
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; CellY++)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; CellX++)
+		{
+			if (const TArray<int32>* CellHandles = Cells.Find(FIntPoint(CellX, CellY)))
+			{
+				GatherCell(*CellHandles);
+			}
+		}
+	}
+}
+
+AActor* FNetworkReplicationSpatialGrid::GetActor(int32 Handle) const
+{
+	return IsValidHandle(Handle) ? Entries[Handle].Actor.Get() : nullptr;
+}
+
+void FNetworkReplicationSpatialGrid::GetAllHandles(TArray<int32>& OutHandles) const
+{
+	for (const TPair<FIntPoint, TArray<int32>>& Pair : Cells)
+	{
+		OutHandles.Append(Pair.Value);
+	}
+}
+
+FIntPoint FNetworkReplicationSpatialGrid::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void FNetworkReplicationSpatialGrid::LinkToCell(int32 Handle)
+{
+	FEntry& Entry = Entries[Handle];
+	TArray<int32>& CellHandles = Cells.FindOrAdd(Entry.Cell);
+	Entry.IndexInCell = CellHandles.Add(Handle);
+}
+
+void FNetworkReplicationSpatialGrid::UnlinkFromCell(int32 Handle)
+{
+	FEntry& Entry = Entries[Handle];
+	TArray<int32>* CellHandles = Cells.Find(Entry.Cell);
+	if (!CellHandles || !CellHandles->IsValidIndex(Entry.IndexInCell))
+	{
+		return;
+	}
+
+	// Swap the last entry of the cell into the freed slot and patch its back index
+	CellHandles->RemoveAtSwap(Entry.IndexInCell, 1, EAllowShrinking::No);
+	if (CellHandles->IsValidIndex(Entry.IndexInCell))
+	{
+		Entries[(*CellHandles)[Entry.IndexInCell]].IndexInCell = Entry.IndexInCell;
+	}
+
+	if (CellHandles->Num() == 0)
+	{
+		Cells.Remove(Entry.Cell);
+	}
+	Entry.IndexInCell = INDEX_NONE;
+}
@@ -0,0 +1,69 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationSpawnBatchAction.cpp
+// Implements the latent Blueprint node that spawns a batch of replicated actors.
+
+#include "NetworkReplicationSpawnBatchAction.h"
+#include "NetworkReplicationComponent.h"
+#include "NetworkReplicationSubsystem.h"
+#include "Engine/GameInstance.h"
+
+UNetworkReplicationSpawnBatchAction* UNetworkReplicationSpawnBatchAction::SpawnActorBatch(UNetworkReplicationComponent* Component, const TArray<FReplicationSpawnRequest>& Requests)
+{
+	UNetworkReplicationSpawnBatchAction* Action = NewObject<UNetworkReplicationSpawnBatchAction>();
+	Action->Component = Component;
+	Action->Requests = Requests;
+	Action->RegisterWithGameInstance(Component);
+	return Action;
+}
+
+void UNetworkReplicationSpawnBatchAction::Activate()
+{
+	UNetworkReplicationComponent* RequestingComponent = Component.Get();
+	UWorld* World = RequestingComponent ? RequestingComponent->GetWorld() : nullptr;
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	UNetworkReplicationSubsystem* ReplicationSubsystem = GameInstance ? GameInstance->GetSubsystem<UNetworkReplicationSubsystem>() : nullptr;
+	if (ReplicationSubsystem)
+	{
+		// The subsystem reports every way a batch can end, including after the requesting component is gone
+		Subsystem = ReplicationSubsystem;
+		ReplicationSubsystem->OnSpawnBatchEnded.AddUObject(this, &UNetworkReplicationSpawnBatchAction::OnSpawnBatchEnded);
+		Handle = RequestingComponent->ReplicateActorSpawnBatch(Requests);
+	}
+
+	if (!Handle.IsValid())
+	{
+		if (ReplicationSubsystem)
+		{
+			ReplicationSubsystem->OnSpawnBatchEnded.RemoveAll(this);
+		}
+		// Rejected before anything was queued, so nothing completed
+		Cancelled.Broadcast(TArray<AActor*>());
+		SetReadyToDestroy();
+	}
+
+	Requests.Empty();
+}
+
+void UNetworkReplicationSpawnBatchAction::OnSpawnBatchEnded(FReplicationSpawnBatchHandle EndedHandle, bool bCompleted, const TArray<AActor*>& SpawnedActors)
+{
+	if (!(EndedHandle == Handle))
+	{
+		return;
+	}
+
+	if (UNetworkReplicationSubsystem* ReplicationSubsystem = Subsystem.Get())
+	{
+		ReplicationSubsystem->OnSpawnBatchEnded.RemoveAll(this);
+	}
+
+	if (bCompleted)
+	{
+		Completed.Broadcast(SpawnedActors);
+	}
+	else
+	{
+		Cancelled.Broadcast(SpawnedActors);
+	}
+	SetReadyToDestroy();
+}
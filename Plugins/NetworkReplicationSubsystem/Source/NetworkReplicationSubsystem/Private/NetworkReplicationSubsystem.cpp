@@ -5,6 +5,11 @@
 
 #include "NetworkReplicationSubsystem.h"
 #include "NetworkReplicationComponent.h"
+#include "NetworkReplicationNameTable.h"
+#include "NetworkReplicationCompressionDictionary.h"
+#include "NetworkReplicationNiagaraPool.h"
+#include "NetworkReplicationActorPool.h"
+#include "NetworkReplicationRelayComponent.h"
 #include "CoreMinimal.h"
 #include "Engine/World.h"
 #include "Misc/FileHelper.h"
@@ -14,6 +19,17 @@
 #include "Engine/Engine.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Net/UnrealNetwork.h"
+#include "Engine/NetConnection.h"
+#include "Engine/ActorChannel.h"
+#include "Engine/NetDriver.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
+
+namespace NetworkReplicationNames
+{
+	/** Server: ids handed out per session. Client RPCs can carry arbitrary names, and every client downloads the whole table */
+	static constexpr int32 MaxAssignedNames = 4096;
+}
 
 void UNetworkReplicationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -39,6 +55,51 @@ void UNetworkReplicationSubsystem::Initialize(FSubsystemCollectionBase& Collecti
 	BandwidthMeasurementStartTime = 0.0f;
 	PerformanceMeasurementStartTime = 0.0f;
 	
+	// Initialize the session name dictionary
+	NameIdSends = 0;
+	NameIdBytesSavedEstimate = 0;
+	bWarnedNameTableFull = false;
+	
+	// Initialize server RPC rate limiting
+	LastRPCBucketPruneTime = 0.0;
+	FMemory::Memzero(RateLimitedDrops);
+	FMemory::Memzero(RateLimitedCoalesced);
+	
+	// Initialize the outbound send budget, refilled at the start of every world tick
+	SendBudgetSpentBytes = 0;
+	SendBudgetDeferredBytes = 0;
+	SendBudgetDroppedBytes = 0;
+	BandwidthWindowBytes = 0;
+	BandwidthWindowSeconds = 0.0f;
+	MeasuredBandwidthKB = 0.0f;
+	
+	// Initialize automatic dormancy stats
+	NumDormantOwners = 0;
+	DormancySleeps = 0;
+	DormancyWakes = 0;
+	
+	// Initialize event fan-out stats
+	FanOutEvents = 0;
+	FanOutSends = 0;
+	FanOutSkippedConnections = 0;
+	
+	// Initialize the running replication aggregates
+	ResetReplicationAggregates();
+	
+	// Initialize the central component tick
+	NextComponentTickIndex = 0;
+	ComponentTickCarry = 0.0f;
+	WorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddUObject(this, &UNetworkReplicationSubsystem::OnWorldTickStart);
+	
+	// Queued events go out after actors tick and before the net driver flushes
+	WorldPostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UNetworkReplicationSubsystem::OnWorldPostActorTick);
+	
+	// Size the interest grid from the default settings
+	InterestGrid.SetCellSize(CurrentSettings.InterestGridCellSize);
+	
+	// Apply the default compression settings
+	PayloadCompressor.Configure(CurrentSettings.bEnableCompression, CurrentSettings.CompressionCodec, CurrentSettings.CompressionThresholdBytes, CurrentSettings.CompressionDictionary);
+	
 	// Initialize the subsystem
 	UE_LOG(LogTemp, Log, TEXT("NetworkReplicationSubsystem initialized"));
 }
@@ -46,40 +107,315 @@ void UNetworkReplicationSubsystem::Initialize(FSubsystemCollectionBase& Collecti
 void UNetworkReplicationSubsystem::Deinitialize()
 {
 	// Clean up registered components
-	RegisteredComponents.Empty();
+	ComponentRegistry.Reset();
+	
+	// Clean up interest management state
+	for (TPair<TObjectKey<AActor>, FInterestEntry>& Pair : InterestEntries)
+	{
+		if (USceneComponent* Root = Pair.Value.Root.Get())
+		{
+			Root->TransformUpdated.Remove(Pair.Value.MoveHandle);
+		}
+	}
+	InterestEntries.Empty();
+	ViewerRelevantHandles.Empty();
+	InterestActors.Empty();
+	TransformCache.Reset();
+	NearestViewerDistancesSquared.Empty();
+	NumCachedViewers = 0;
+	CachedViewers.Empty();
+	ConnectionRelays.Empty();
+	PendingSpawnBatches.Empty();
+	
+	// Clean up the session name dictionary
+	NameToId.Empty();
+	IdToName.Empty();
+	NameIdSavings.Empty();
+	NameWaiters.Empty();
+	
+	// Clean up rate limiting state
+	RPCTokenBuckets.Empty();
+	
+	// Clean up send budget state
+	FWorldDelegates::OnWorldTickStart.Remove(WorldTickStartHandle);
+	SendBudgets.Empty();
+	
+	// Clean up the send scheduler
+	FWorldDelegates::OnWorldPostActorTick.Remove(WorldPostActorTickHandle);
+	SendSchedule.Empty();
 	
 	Super::Deinitialize();
 	UE_LOG(LogTemp, Log, TEXT("NetworkReplicationSubsystem deinitialized"));
 }
 
+// ===== CENTRAL TICK =====
+
+void UNetworkReplicationSubsystem::Tick(float DeltaTime)
+{
+	RefreshTransformCache();
+
+	if (PendingSpawnBatches.Num() > 0)
+	{
+		ProcessSpawnBatches();
+	}
+
+	// Stat sampling
+	BandwidthWindowSeconds += DeltaTime;
+	if (BandwidthWindowSeconds >= 1.0f)
+	{
+		MeasuredBandwidthKB = static_cast<float>(BandwidthWindowBytes / 1024.0 / BandwidthWindowSeconds);
+		BandwidthWindowBytes = 0;
+		BandwidthWindowSeconds = 0.0f;
+
+		if (bBandwidthMonitoringActive)
+		{
+			CurrentBandwidthUsage = MeasuredBandwidthKB;
+			BandwidthHistory.Add(MeasuredBandwidthKB);
+		}
+
+		// Forget relevancy state of viewers that have been destroyed
+		for (auto It = ViewerRelevantHandles.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().ResolveObjectPtr())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	const int32 NumComponents = ComponentRegistry.Num();
+	if (NumComponents == 0)
+	{
+		return;
+	}
+
+	// Spread the components over ReplicationInterval; a long frame catches up at most one full pass
+	const float Interval = FMath::Max(CurrentSettings.ReplicationInterval, KINDA_SMALL_NUMBER);
+	ComponentTickCarry = FMath::Min(ComponentTickCarry + NumComponents * DeltaTime / Interval, static_cast<float>(NumComponents));
+	const int32 NumToProcess = FMath::FloorToInt(ComponentTickCarry);
+	ComponentTickCarry -= NumToProcess;
+
+	for (int32 Processed = 0; Processed < NumToProcess; Processed++)
+	{
+		if (NextComponentTickIndex >= ComponentRegistry.Num())
+		{
+			NextComponentTickIndex = 0;
+		}
+
+		UNetworkReplicationComponent* Component = ComponentRegistry.GetComponents()[NextComponentTickIndex++];
+		if (IsValid(Component))
+		{
+			Component->TickReplication();
+		}
+	}
+}
+
+void UNetworkReplicationSubsystem::RefreshTransformCache()
+{
+	TransformCache.Reset(InterestEntries.Num());
+	for (TPair<TObjectKey<AActor>, FInterestEntry>& Pair : InterestEntries)
+	{
+		FInterestEntry& Entry = Pair.Value;
+		if (!InterestGrid.IsValidHandle(Entry.GridHandle))
+		{
+			Entry.CacheIndex = INDEX_NONE;
+			continue;
+		}
+
+		// The grid already tracks the location, and the root's cached bounds avoid touching the actor at all
+		const USceneComponent* Root = Entry.Root.Get();
+		Entry.CacheIndex = TransformCache.Add(InterestGrid.GetActor(Entry.GridHandle), InterestGrid.GetLocation(Entry.GridHandle), Root ? Root->Bounds.SphereRadius : 0.0f);
+	}
+	TransformCache.Finalize();
+
+	// Snapshot every viewer once for event fan-out, which may run many times per tick
+	NearestViewerDistancesSquared.Reset();
+	NumCachedViewers = 0;
+	CachedViewers.Reset();
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PlayerController = It->Get();
+		const AActor* ViewTarget = PlayerController ? PlayerController->GetViewTarget() : nullptr;
+		if (!ViewTarget)
+		{
+			continue;
+		}
+
+		CachedViewers.Add({ PlayerController, ViewTarget->GetActorLocation() });
+
+		// Create relays ahead of the first event so they have replicated by the time a send arrives
+		if (CurrentSettings.bEnableEventFanOut && !PlayerController->IsLocalController())
+		{
+			GetConnectionRelay(PlayerController);
+		}
+	}
+
+	// Relays are destroyed with their controllers when players leave
+	if (ConnectionRelays.Num() > CachedViewers.Num())
+	{
+		for (auto It = ConnectionRelays.CreateIterator(); It; ++It)
+		{
+			if (!It->Value.IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	// Fold every viewer into a single nearest-viewer distance per entry for the send scheduler, its only consumer
+	if (TransformCache.Num() == 0 || CachedViewers.Num() == 0)
+	{
+		return;
+	}
+
+	NearestViewerDistancesSquared.Init(TNumericLimits<float>::Max(), TransformCache.Num());
+	for (const FCachedViewer& Viewer : CachedViewers)
+	{
+		TransformCache.AccumulateNearestDistanceSquared(Viewer.ViewLocation, NearestViewerDistancesSquared);
+	}
+	NumCachedViewers = CachedViewers.Num();
+}
+
+void UNetworkReplicationSubsystem::RunRelevancyBenchmark() const
+{
+	const int32 EntryCounts[] = { 1000, 10000, 50000 };
+	const int32 Iterations = 200;
+	const float CullDistance = CurrentSettings.MaxReplicationDistance;
+
+	FRandomStream Random(0x5EED);
+	TArray<uint32> VectorMask;
+	TArray<uint32> ScalarMask;
+	TArray<float> DistancesSquared;
+
+	for (const int32 NumEntries : EntryCounts)
+	{
+		FNetworkReplicationTransformCache Cache;
+		Cache.Reset(NumEntries);
+		for (int32 Index = 0; Index < NumEntries; Index++)
+		{
+			const FVector Location(Random.FRandRange(-200000.0f, 200000.0f), Random.FRandRange(-200000.0f, 200000.0f), Random.FRandRange(0.0f, 5000.0f));
+			Cache.Add(nullptr, Location, Random.FRandRange(50.0f, 500.0f));
+		}
+		Cache.Finalize();
+
+		const FVector ViewLocation(Random.FRandRange(-50000.0f, 50000.0f), Random.FRandRange(-50000.0f, 50000.0f), 0.0f);
+
+		const double VectorStart = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			Cache.CullSphere(ViewLocation, CullDistance, VectorMask, DistancesSquared);
+		}
+		const double VectorMs = (FPlatformTime::Seconds() - VectorStart) * 1000.0 / Iterations;
+
+		const double ScalarStart = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			Cache.CullSphereScalar(ViewLocation, CullDistance, ScalarMask, DistancesSquared);
+		}
+		const double ScalarMs = (FPlatformTime::Seconds() - ScalarStart) * 1000.0 / Iterations;
+
+		int32 NumRelevant = 0;
+		for (const uint32 Word : VectorMask)
+		{
+			NumRelevant += FMath::CountBits(Word);
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("Relevancy kernel: %d entries, %.4f ms vector, %.4f ms scalar per viewer (%.1fx), %d relevant, masks %s"),
+			NumEntries, VectorMs, ScalarMs, VectorMs > 0.0 ? ScalarMs / VectorMs : 0.0, NumRelevant, VectorMask == ScalarMask ? TEXT("match") : TEXT("DIFFER"));
+	}
+}
+
+ETickableTickType UNetworkReplicationSubsystem::GetTickableTickType() const
+{
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UNetworkReplicationSubsystem::IsTickable() const
+{
+	return GetGameInstance() != nullptr;
+}
+
+UWorld* UNetworkReplicationSubsystem::GetTickableGameObjectWorld() const
+{
+	return GetWorld();
+}
+
+TStatId UNetworkReplicationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UNetworkReplicationSubsystem, STATGROUP_Tickables);
+}
+
 void UNetworkReplicationSubsystem::RegisterReplicationComponent(UNetworkReplicationComponent* Component)
 {
-	if (!Component)
+	// A component that has not begun play would never reach the EndPlay that removes it again
+	if (!Component || !Component->HasBegunPlay() || Component->GetWorld() != GetWorld())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Attempted to register null replication component"));
+		UE_LOG(LogTemp, Warning, TEXT("RegisterReplicationComponent is deprecated and ignores %s, components register themselves in BeginPlay"), *GetNameSafe(Component));
 		return;
 	}
 
-	// Add to registered components
-	RegisteredComponents.AddUnique(Component);
-	UE_LOG(LogTemp, Log, TEXT("Registered replication component for actor %s"), *Component->GetOwner()->GetName());
+	AddRegisteredComponent(Component);
 }
 
 void UNetworkReplicationSubsystem::UnregisterReplicationComponent(UNetworkReplicationComponent* Component)
+{
+	RemoveRegisteredComponent(Component);
+}
+
+void UNetworkReplicationSubsystem::AddRegisteredComponent(UNetworkReplicationComponent* Component)
 {
 	if (!Component)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Attempted to register null replication component"));
+		return;
+	}
+
+	// The component's own handle answers whether it is already registered, without scanning
+	if (ComponentRegistry.Get(Component->RegistryHandle) == Component)
+	{
+		return;
+	}
+
+	Component->RegistryHandle = ComponentRegistry.Add(Component);
+	AddComponentAggregates(Component, 1);
+	AddInterestEntry(Component->GetOwner());
+	UE_CLOG(Component->bDebugMode, LogTemp, Log, TEXT("Registered replication component for actor %s"), *GetNameSafe(Component->GetOwner()));
+}
+
+void UNetworkReplicationSubsystem::RemoveRegisteredComponent(UNetworkReplicationComponent* Component)
+{
+	if (!Component || ComponentRegistry.Get(Component->RegistryHandle) != Component)
 	{
 		return;
 	}
 
-	// Remove from registered components
-	RegisteredComponents.Remove(Component);
-	UE_LOG(LogTemp, Log, TEXT("Unregistered replication component for actor %s"), *Component->GetOwner()->GetName());
+	ComponentRegistry.Remove(Component->RegistryHandle);
+	Component->RegistryHandle.Reset();
+	AddComponentAggregates(Component, -1);
+	NameWaiters.Remove(Component);
+	RemoveInterestEntry(Component->GetOwner());
+	UE_CLOG(Component->bDebugMode, LogTemp, Log, TEXT("Unregistered replication component for actor %s"), *GetNameSafe(Component->GetOwner()));
+}
+
+void UNetworkReplicationSubsystem::GetRegistryStats(int32& OutLive, int32& OutSlots, int32& OutFreeSlots) const
+{
+	OutLive = ComponentRegistry.Num();
+	OutSlots = ComponentRegistry.NumSlots();
+	OutFreeSlots = ComponentRegistry.NumFreeSlots();
 }
 
 void UNetworkReplicationSubsystem::SetReplicationSettings(const FNetworkReplicationSettings& Settings)
 {
 	CurrentSettings = Settings;
+	RelevancyRevision++;
+	InterestGrid.SetCellSize(CurrentSettings.InterestGridCellSize);
+	PayloadCompressor.Configure(CurrentSettings.bEnableCompression, CurrentSettings.CompressionCodec, CurrentSettings.CompressionThresholdBytes, CurrentSettings.CompressionDictionary);
 	UE_LOG(LogTemp, Log, TEXT("Replication settings updated"));
 }
 
@@ -96,13 +432,13 @@ void UNetworkReplicationSubsystem::OptimizeReplication()
 
 int32 UNetworkReplicationSubsystem::GetActiveReplicationCount() const
 {
-	return RegisteredComponents.Num();
+	return ComponentRegistry.Num();
 }
 
 float UNetworkReplicationSubsystem::GetReplicationBandwidth() const
 {
-	// Return estimated bandwidth usage
-	return RegisteredComponents.Num() * 0.1f; // 0.1 KB per component
+	// Outbound KB/s charged to the send budget, summed over all connections
+	return MeasuredBandwidthKB;
 }
 
 void UNetworkReplicationSubsystem::OnComponentDestroyed(UNetworkReplicationComponent* Component)
@@ -117,27 +453,16 @@ void UNetworkReplicationSubsystem::OnComponentDestroyed(UNetworkReplicationCompo
 
 void UNetworkReplicationSubsystem::ShowNetworkStats()
 {
-	int32 TotalComponents = RegisteredComponents.Num();
-	int32 TotalReplications = 0;
-	
-	for (UNetworkReplicationComponent* Component : RegisteredComponents)
-	{
-		if (Component)
-		{
-			TotalReplications += Component->TotalReplications;
-		}
-	}
-	
 	UE_LOG(LogTemp, Log, TEXT("Network Stats - Components: %d, Total Replications: %d"), 
-		TotalComponents, TotalReplications);
+		ComponentRegistry.Num(), GetTotalReplications());
 }
 
 void UNetworkReplicationSubsystem::ExportReplicationData()
 {
 	FString Data = FString::Printf(TEXT("Network Replication Data Export\n"));
-	Data += FString::Printf(TEXT("Components: %d\n"), RegisteredComponents.Num());
+	Data += FString::Printf(TEXT("Components: %d\n"), ComponentRegistry.Num());
 	
-	for (UNetworkReplicationComponent* Component : RegisteredComponents)
+	for (UNetworkReplicationComponent* Component : ComponentRegistry.GetComponents())
 	{
 		if (Component)
 		{
@@ -154,15 +479,30 @@ void UNetworkReplicationSubsystem::ExportReplicationData()
 
 void UNetworkReplicationSubsystem::ResetReplicationStats()
 {
-	for (UNetworkReplicationComponent* Component : RegisteredComponents)
+	for (UNetworkReplicationComponent* Component : ComponentRegistry.GetComponents())
 	{
 		if (Component)
 		{
 			Component->TotalReplications = 0;
 			Component->LastReplicationTime = 0.0f;
+			Component->SuppressedReplications = 0;
+			Component->StateResends = 0;
 		}
 	}
 	
+	ResetReplicationAggregates();
+	PayloadCompressor.ResetStats();
+	FMemory::Memzero(RateLimitedDrops);
+	FMemory::Memzero(RateLimitedCoalesced);
+	SendBudgetSpentBytes = 0;
+	SendBudgetDeferredBytes = 0;
+	SendBudgetDroppedBytes = 0;
+	DormancySleeps = 0;
+	DormancyWakes = 0;
+	FanOutEvents = 0;
+	FanOutSends = 0;
+	FanOutSkippedConnections = 0;
+	
 	UE_LOG(LogTemp, Log, TEXT("Replication stats reset"));
 }
 
@@ -170,32 +510,71 @@ void UNetworkReplicationSubsystem::ResetReplicationStats()
 
 int32 UNetworkReplicationSubsystem::GetTotalReplications() const
 {
-	int32 Total = 0;
-	for (UNetworkReplicationComponent* Component : RegisteredComponents)
+	return static_cast<int32>(FMath::Min<int64>(AggregateReplications, MAX_int32));
+}
+
+float UNetworkReplicationSubsystem::GetAverageLatency() const
+{
+	// Mean last replication time over registered components that have replicated
+	return NumReplicatedComponents > 0 ? static_cast<float>(AggregateReplicationTimeSum / NumReplicatedComponents) : 0.0f;
+}
+
+FReplicationFamilyStats UNetworkReplicationSubsystem::GetReplicationFamilyStats(EReplicationRPCFamily Family) const
+{
+	const int32 Index = static_cast<int32>(Family);
+	return Index >= 0 && Index < static_cast<int32>(EReplicationRPCFamily::Count) ? FamilyStats[Index] : FReplicationFamilyStats();
+}
+
+void UNetworkReplicationSubsystem::RecordComponentReplication(EReplicationRPCFamily Family, float PreviousTime, float NewTime)
+{
+	AggregateReplications++;
+	if (PreviousTime > 0.0f)
 	{
-		if (Component)
-		{
-			Total += Component->TotalReplications;
-		}
+		AggregateReplicationTimeSum += NewTime - PreviousTime;
+	}
+	else if (NewTime > 0.0f)
+	{
+		AggregateReplicationTimeSum += NewTime;
+		NumReplicatedComponents++;
+	}
+
+	FReplicationFamilyStats& Stats = FamilyStats[static_cast<int32>(Family)];
+	Stats.Replications++;
+	if (PreviousTime > 0.0f)
+	{
+		const float Interval = FMath::Max(NewTime - PreviousTime, 0.0f);
+		Stats.MinIntervalSeconds = Stats.Intervals > 0 ? FMath::Min(Stats.MinIntervalSeconds, Interval) : Interval;
+		Stats.MaxIntervalSeconds = FMath::Max(Stats.MaxIntervalSeconds, Interval);
+		Stats.IntervalSumSeconds += Interval;
+		Stats.Intervals++;
 	}
-	return Total;
 }
 
-float UNetworkReplicationSubsystem::GetAverageLatency() const
+void UNetworkReplicationSubsystem::AddComponentAggregates(const UNetworkReplicationComponent* Component, int32 Sign)
 {
-	float TotalLatency = 0.0f;
-	int32 Count = 0;
-	
-	for (UNetworkReplicationComponent* Component : RegisteredComponents)
+	AggregateReplications = FMath::Max<int64>(AggregateReplications + Sign * Component->TotalReplications, 0);
+	if (Component->LastReplicationTime > 0.0f)
 	{
-		if (Component && Component->LastReplicationTime > 0.0f)
-		{
-			TotalLatency += Component->LastReplicationTime;
-			Count++;
-		}
+		AggregateReplicationTimeSum += Sign * Component->LastReplicationTime;
+		NumReplicatedComponents = FMath::Max(NumReplicatedComponents + Sign, 0);
+	}
+
+	// Subtracting floats can leave a residue once the last contributor has gone
+	if (NumReplicatedComponents == 0)
+	{
+		AggregateReplicationTimeSum = 0.0;
+	}
+}
+
+void UNetworkReplicationSubsystem::ResetReplicationAggregates()
+{
+	AggregateReplications = 0;
+	AggregateReplicationTimeSum = 0.0;
+	NumReplicatedComponents = 0;
+	for (FReplicationFamilyStats& Stats : FamilyStats)
+	{
+		Stats = FReplicationFamilyStats();
 	}
-	
-	return Count > 0 ? TotalLatency / Count : 0.0f;
 }
 
 void UNetworkReplicationSubsystem::OptimizeForBandwidth(float MaxBandwidthKB)
@@ -217,12 +596,14 @@ void UNetworkReplicationSubsystem::OptimizeForBandwidth(float MaxBandwidthKB)
 void UNetworkReplicationSubsystem::SetReplicationDistance(float Distance)
 {
 	CurrentSettings.MaxReplicationDistance = Distance;
+	RelevancyRevision++;
 	UE_LOG(LogTemp, Log, TEXT("Replication distance set to: %.2f"), Distance);
 }
 
 void UNetworkReplicationSubsystem::EnableRelevancyCulling(bool bEnabled)
 {
 	CurrentSettings.bEnableRelevancy = bEnabled;
+	RelevancyRevision++;
 	UE_LOG(LogTemp, Log, TEXT("Relevancy culling %s"), bEnabled ? TEXT("enabled") : TEXT("disabled"));
 }
 
@@ -238,8 +619,28 @@ bool UNetworkReplicationSubsystem::IsActorRelevantToPlayer(AActor* Actor, AActor
 		return true;
 	}
 	
-	float Distance = FVector::Dist(Actor->GetActorLocation(), Player->GetActorLocation());
-	return Distance <= CurrentSettings.MaxReplicationDistance;
+	float InnerRadius = 0.0f;
+	float OuterRadius = 0.0f;
+	GetRelevancyRadii(InnerRadius, OuterRadius);
+	
+	const double DistanceSquared = FVector::DistSquared(Actor->GetActorLocation(), Player->GetActorLocation());
+	if (DistanceSquared <= FMath::Square(InnerRadius))
+	{
+		return true;
+	}
+	if (DistanceSquared > FMath::Square(OuterRadius))
+	{
+		return false;
+	}
+	
+	// Inside the hysteresis band, keep whatever the player's last GetRelevantActors query decided
+	const FInterestEntry* Entry = InterestEntries.Find(Actor);
+	const TSet<int32>* RelevantHandles = ViewerRelevantHandles.Find(Player);
+	if (Entry && RelevantHandles)
+	{
+		return RelevantHandles->Contains(Entry->GridHandle);
+	}
+	return DistanceSquared <= FMath::Square(CurrentSettings.MaxReplicationDistance);
 }
 
 // ===== ADVANCED DEBUGGING TOOLS IMPLEMENTATIONS =====
@@ -259,10 +660,59 @@ void UNetworkReplicationSubsystem::StopNetworkProfiling()
 FString UNetworkReplicationSubsystem::GetNetworkInsights()
 {
 	FString Insights = TEXT("Network Insights:\n");
-	Insights += FString::Printf(TEXT("Active Components: %d\n"), RegisteredComponents.Num());
+	Insights += FString::Printf(TEXT("Active Components: %d\n"), ComponentRegistry.Num());
+	Insights += FString::Printf(TEXT("Component Registry: %d live, %d slots, %d free\n"), ComponentRegistry.Num(), ComponentRegistry.NumSlots(), ComponentRegistry.NumFreeSlots());
 	Insights += FString::Printf(TEXT("Total Replications: %d\n"), GetTotalReplications());
 	Insights += FString::Printf(TEXT("Average Latency: %.2f\n"), GetAverageLatency());
-	Insights += FString::Printf(TEXT("Bandwidth Usage: %.2f KB\n"), GetReplicationBandwidth());
+	for (int32 Family = 0; Family < static_cast<int32>(EReplicationRPCFamily::Count); Family++)
+	{
+		const FReplicationFamilyStats& Stats = FamilyStats[Family];
+		if (Stats.Replications > 0)
+		{
+			Insights += FString::Printf(TEXT("Replications %s: %lld, interval %.3f min, %.3f avg, %.3f max s\n"),
+				*UEnum::GetDisplayValueAsText(static_cast<EReplicationRPCFamily>(Family)).ToString(), Stats.Replications,
+				Stats.MinIntervalSeconds, Stats.GetAverageIntervalSeconds(), Stats.MaxIntervalSeconds);
+		}
+	}
+	Insights += FString::Printf(TEXT("Bandwidth Usage: %.2f KB/s\n"), GetReplicationBandwidth());
+	Insights += FString::Printf(TEXT("Send Budget: %lld bytes spent, %lld deferred, %lld dropped\n"), SendBudgetSpentBytes, SendBudgetDeferredBytes, SendBudgetDroppedBytes);
+	Insights += FString::Printf(TEXT("Send Scheduler: %d components queued\n"), SendSchedule.Num());
+	Insights += FString::Printf(TEXT("Dormancy: %d dormant, %d awake, %lld sleeps, %lld wakes\n"), NumDormantOwners, FMath::Max(InterestEntries.Num() - NumDormantOwners, 0), DormancySleeps, DormancyWakes);
+	Insights += FString::Printf(TEXT("Interest Grid: %d actors in %d cells, %d viewers\n"), InterestGrid.Num(), InterestGrid.NumCells(), ViewerRelevantHandles.Num());
+	Insights += FString::Printf(TEXT("Transform Cache: %d entries, %d viewers\n"), TransformCache.Num(), NumCachedViewers);
+	Insights += FString::Printf(TEXT("Event Fan-Out: %lld events, %lld sends, %lld connections skipped\n"), FanOutEvents, FanOutSends, FanOutSkippedConnections);
+	if (const UNetworkReplicationNiagaraPool* NiagaraPool = GetWorld() ? GetWorld()->GetSubsystem<UNetworkReplicationNiagaraPool>() : nullptr)
+	{
+		int32 NumLive, NumIdle;
+		int64 Hits, Misses, Recycled;
+		NiagaraPool->GetPoolStats(NumLive, NumIdle, Hits, Misses, Recycled);
+		Insights += FString::Printf(TEXT("Niagara Pool: %d live, %d idle, %lld hits, %lld misses, %lld recycled\n"), NumLive, NumIdle, Hits, Misses, Recycled);
+	}
+	if (const UNetworkReplicationActorPool* ActorPool = GetWorld() ? GetWorld()->GetSubsystem<UNetworkReplicationActorPool>() : nullptr)
+	{
+		int32 NumLive, NumIdle;
+		int64 Hits, Misses, Discarded;
+		ActorPool->GetPoolStats(NumLive, NumIdle, Hits, Misses, Discarded);
+		const double HitRate = Hits + Misses > 0 ? 100.0 * Hits / (Hits + Misses) : 0.0;
+		Insights += FString::Printf(TEXT("Actor Pool: %d live, %d idle, %lld hits, %lld misses (%.1f%% hit rate), %lld discarded\n"), NumLive, NumIdle, Hits, Misses, HitRate, Discarded);
+	}
+	Insights += FString::Printf(TEXT("Spawn Batches: %d pending, %lld actors spawned\n"), PendingSpawnBatches.Num(), BatchSpawnedActors);
+	Insights += FString::Printf(TEXT("Name Table: %d names, %lld id sends, %lld bytes saved (estimated)\n"), IdToName.Num(), NameIdSends, NameIdBytesSavedEstimate);
+	for (int32 Category = 0; Category < static_cast<int32>(EReplicationPayloadCategory::Count); Category++)
+	{
+		const FReplicationCompressionStats& Stats = PayloadCompressor.GetStats(static_cast<EReplicationPayloadCategory>(Category));
+		Insights += FString::Printf(TEXT("Compression %s: %lld/%lld compressed, ratio %.2f, %.3f ms compress, %.3f ms decompress\n"),
+			*UEnum::GetDisplayValueAsText(static_cast<EReplicationPayloadCategory>(Category)).ToString(),
+			Stats.CompressedPayloads, Stats.Payloads, Stats.GetRatio(), Stats.CompressSeconds * 1000.0, Stats.DecompressSeconds * 1000.0);
+	}
+	int64 TotalDropped = 0;
+	int64 TotalCoalesced = 0;
+	for (int32 Family = 0; Family < static_cast<int32>(EReplicationRPCFamily::Count); Family++)
+	{
+		TotalDropped += RateLimitedDrops[Family];
+		TotalCoalesced += RateLimitedCoalesced[Family];
+	}
+	Insights += FString::Printf(TEXT("Rate Limited RPCs: %lld dropped, %lld coalesced\n"), TotalDropped, TotalCoalesced);
 	Insights += FString::Printf(TEXT("Profiling Active: %s\n"), bNetworkProfilingActive ? TEXT("Yes") : TEXT("No"));
 	Insights += FString::Printf(TEXT("Simulation Active: %s\n"), bNetworkSimulationActive ? TEXT("Yes") : TEXT("No"));
 	
@@ -316,6 +766,13 @@ void UNetworkReplicationSubsystem::RegisterConsoleCommands()
 		ECVF_Default
 	);
 	
+	IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("NetworkReplication.BenchmarkRelevancy"),
+		TEXT("Time the relevancy culling kernels against 1k, 10k and 50k entries"),
+		FConsoleCommandDelegate::CreateLambda([this]() { RunRelevancyBenchmark(); }),
+		ECVF_Default
+	);
+	
 	UE_LOG(LogTemp, Log, TEXT("Basic NetworkReplication console commands registered"));
 }
 
@@ -325,6 +782,7 @@ void UNetworkReplicationSubsystem::UnregisterConsoleCommands()
 	IConsoleManager::Get().UnregisterConsoleObject(TEXT("NetworkReplication.ShowStats"));
 	IConsoleManager::Get().UnregisterConsoleObject(TEXT("NetworkReplication.ExportData"));
 	IConsoleManager::Get().UnregisterConsoleObject(TEXT("NetworkReplication.ResetStats"));
+	IConsoleManager::Get().UnregisterConsoleObject(TEXT("NetworkReplication.BenchmarkRelevancy"));
 	
 	UE_LOG(LogTemp, Log, TEXT("Basic NetworkReplication console commands unregistered"));
 }
@@ -353,6 +811,7 @@ bool UNetworkReplicationSubsystem::IsPredictionEnabled() const
 void UNetworkReplicationSubsystem::SetInterestRadius(float Radius)
 {
 	CurrentSettings.MaxReplicationDistance = Radius;
+	RelevancyRevision++;
 	UE_LOG(LogTemp, Log, TEXT("Interest radius set to: %.2f"), Radius);
 }
 
@@ -361,6 +820,7 @@ void UNetworkReplicationSubsystem::AddInterestActor(AActor* Actor)
 	if (Actor && !InterestActors.Contains(Actor))
 	{
 		InterestActors.Add(Actor);
+		RelevancyRevision++;
 		UE_LOG(LogTemp, Log, TEXT("Added interest actor: %s"), *Actor->GetName());
 	}
 }
@@ -370,41 +830,181 @@ void UNetworkReplicationSubsystem::RemoveInterestActor(AActor* Actor)
 	if (Actor && InterestActors.Contains(Actor))
 	{
 		InterestActors.Remove(Actor);
+		ViewerRelevantHandles.Remove(Actor);
+		RelevancyRevision++;
 		UE_LOG(LogTemp, Log, TEXT("Removed interest actor: %s"), *Actor->GetName());
 	}
 }
 
-// Console command implementations removed for simplicity
-
-// ===== PHASE 3: ADVANCED PERFORMANCE MONITORING IMPLEMENTATIONS =====
+bool UNetworkReplicationSubsystem::IsInterestActor(AActor* Actor) const
+{
+	return Actor && InterestActors.Contains(Actor);
+}
 
-void UNetworkReplicationSubsystem::StartPerformanceMonitoring()
+void UNetworkReplicationSubsystem::GetRelevantActors(AActor* Viewer, TArray<AActor*>& OutActors)
 {
-	bPerformanceMonitoringActive = true;
-	PerformanceMeasurementStartTime = GetWorld()->GetTimeSeconds();
-	PerformanceData.Empty();
-	
-	UE_LOG(LogTemp, Log, TEXT("Performance monitoring started"));
+	OutActors.Reset();
+	if (!Viewer)
+	{
+		return;
+	}
+
+	TArray<int32> Candidates;
+	if (!CurrentSettings.bEnableRelevancy)
+	{
+		InterestGrid.GetAllHandles(Candidates);
+		for (int32 Handle : Candidates)
+		{
+			if (AActor* Actor = InterestGrid.GetActor(Handle))
+			{
+				OutActors.Add(Actor);
+			}
+		}
+		return;
+	}
+
+	float InnerRadius = 0.0f;
+	float OuterRadius = 0.0f;
+	GetRelevancyRadii(InnerRadius, OuterRadius);
+
+	const FVector ViewLocation = Viewer->GetActorLocation();
+	InterestGrid.QueryRadius(ViewLocation, OuterRadius, Candidates);
+
+	TSet<int32>& RelevantHandles = ViewerRelevantHandles.FindOrAdd(Viewer);
+	TSet<int32> NowRelevant;
+	NowRelevant.Reserve(Candidates.Num());
+
+	const double InnerRadiusSquared = FMath::Square(static_cast<double>(InnerRadius));
+	for (int32 Handle : Candidates)
+	{
+		// Inside the inner radius always counts; the band out to the outer radius only keeps actors that were already relevant
+		if (FVector::DistSquared(InterestGrid.GetLocation(Handle), ViewLocation) <= InnerRadiusSquared || RelevantHandles.Contains(Handle))
+		{
+			NowRelevant.Add(Handle);
+			if (AActor* Actor = InterestGrid.GetActor(Handle))
+			{
+				OutActors.Add(Actor);
+			}
+		}
+	}
+
+	RelevantHandles = MoveTemp(NowRelevant);
 }
 
-void UNetworkReplicationSubsystem::StopPerformanceMonitoring()
+void UNetworkReplicationSubsystem::AddInterestEntry(AActor* Owner)
 {
-	bPerformanceMonitoringActive = false;
-	UE_LOG(LogTemp, Log, TEXT("Performance monitoring stopped"));
+	if (!Owner)
+	{
+		return;
+	}
+
+	FInterestEntry& Entry = InterestEntries.FindOrAdd(Owner);
+	if (Entry.NumComponents++ > 0)
+	{
+		return;
+	}
+
+	Entry.GridHandle = InterestGrid.Add(Owner, Owner->GetActorLocation());
+	if (USceneComponent* Root = Owner->GetRootComponent())
+	{
+		Entry.Root = Root;
+		Entry.MoveHandle = Root->TransformUpdated.AddUObject(this, &UNetworkReplicationSubsystem::OnOwnerTransformUpdated, Entry.GridHandle);
+	}
 }
 
-FString UNetworkReplicationSubsystem::GetDetailedPerformanceReport() const
+void UNetworkReplicationSubsystem::RemoveInterestEntry(AActor* Owner)
 {
-	FString Report = TEXT("=== DETAILED PERFORMANCE REPORT ===\n");
-	
-	// Basic stats
-	Report += FString::Printf(TEXT("Active Components: %d\n"), RegisteredComponents.Num());
-	Report += FString::Printf(TEXT("Total Replications: %d\n"), GetTotalReplications());
-	Report += FString::Printf(TEXT("Average Latency: %.2f ms\n"), GetAverageLatency());
-	Report += FString::Printf(TEXT("Current Bandwidth: %.2f KB/s\n"), GetReplicationBandwidth());
-	
-	// Performance thresholds
-	Report += FString::Printf(TEXT("Max Latency Threshold: %.2f ms\n"), MaxLatencyThreshold);
+	FInterestEntry* Entry = Owner ? InterestEntries.Find(Owner) : nullptr;
+	if (!Entry || --Entry->NumComponents > 0)
+	{
+		return;
+	}
+
+	if (USceneComponent* Root = Entry->Root.Get())
+	{
+		Root->TransformUpdated.Remove(Entry->MoveHandle);
+	}
+
+	// The handle will be reused, so no viewer may remember it
+	for (TPair<TObjectKey<AActor>, TSet<int32>>& Pair : ViewerRelevantHandles)
+	{
+		Pair.Value.Remove(Entry->GridHandle);
+	}
+
+	InterestGrid.Remove(Entry->GridHandle);
+	InterestEntries.Remove(Owner);
+}
+
+void UNetworkReplicationSubsystem::OnOwnerTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, int32 GridHandle)
+{
+	InterestGrid.Move(GridHandle, UpdatedComponent->GetComponentLocation());
+}
+
+void UNetworkReplicationSubsystem::GetRelevancyRadii(float& OutInnerRadius, float& OutOuterRadius) const
+{
+	const float Hysteresis = FMath::Clamp(CurrentSettings.RelevancyHysteresis, 0.0f, 0.9f);
+	OutInnerRadius = CurrentSettings.MaxReplicationDistance * (1.0f - Hysteresis);
+	OutOuterRadius = CurrentSettings.MaxReplicationDistance * (1.0f + Hysteresis);
+}
+
+// Console command implementations removed for simplicity
+
+// ===== PHASE 3: ADVANCED PERFORMANCE MONITORING IMPLEMENTATIONS =====
+
+void UNetworkReplicationSubsystem::StartPerformanceMonitoring()
+{
+	bPerformanceMonitoringActive = true;
+	PerformanceMeasurementStartTime = GetWorld()->GetTimeSeconds();
+	PerformanceData.Empty();
+	
+	UE_LOG(LogTemp, Log, TEXT("Performance monitoring started"));
+}
+
+void UNetworkReplicationSubsystem::StopPerformanceMonitoring()
+{
+	bPerformanceMonitoringActive = false;
+	UE_LOG(LogTemp, Log, TEXT("Performance monitoring stopped"));
+}
+
+FString UNetworkReplicationSubsystem::GetDetailedPerformanceReport() const
+{
+	FString Report = TEXT("=== DETAILED PERFORMANCE REPORT ===\n");
+	
+	// Basic stats
+	Report += FString::Printf(TEXT("Active Components: %d\n"), ComponentRegistry.Num());
+	Report += FString::Printf(TEXT("Total Replications: %d\n"), GetTotalReplications());
+	Report += FString::Printf(TEXT("Average Latency: %.2f ms\n"), GetAverageLatency());
+	Report += FString::Printf(TEXT("Current Bandwidth: %.2f KB/s\n"), GetReplicationBandwidth());
+	Report += FString::Printf(TEXT("Name Table: %d names, %lld id sends, %lld bytes saved (estimated)\n"), IdToName.Num(), NameIdSends, NameIdBytesSavedEstimate);
+	for (int32 Category = 0; Category < static_cast<int32>(EReplicationPayloadCategory::Count); Category++)
+	{
+		const FReplicationCompressionStats& Stats = PayloadCompressor.GetStats(static_cast<EReplicationPayloadCategory>(Category));
+		Report += FString::Printf(TEXT("Compression %s: %lld raw bytes, %lld wire bytes, ratio %.2f, %.3f ms compress, %.3f ms decompress\n"),
+			*UEnum::GetDisplayValueAsText(static_cast<EReplicationPayloadCategory>(Category)).ToString(),
+			Stats.RawBytes, Stats.WireBytes, Stats.GetRatio(), Stats.CompressSeconds * 1000.0, Stats.DecompressSeconds * 1000.0);
+	}
+	
+	// Server RPC rate limiting
+	for (int32 Family = 0; Family < static_cast<int32>(EReplicationRPCFamily::Count); Family++)
+	{
+		if (RateLimitedDrops[Family] > 0 || RateLimitedCoalesced[Family] > 0)
+		{
+			Report += FString::Printf(TEXT("Rate Limited %s: %lld dropped, %lld coalesced\n"),
+				*UEnum::GetDisplayValueAsText(static_cast<EReplicationRPCFamily>(Family)).ToString(), RateLimitedDrops[Family], RateLimitedCoalesced[Family]);
+		}
+	}
+	
+	// Outbound send budget
+	Report += FString::Printf(TEXT("Send Budget: %.2f KB/s per connection, %lld bytes spent, %lld deferred, %lld dropped\n"),
+		CurrentSettings.BandwidthLimitKB, SendBudgetSpentBytes, SendBudgetDeferredBytes, SendBudgetDroppedBytes);
+	Report += FString::Printf(TEXT("Send Scheduler: %d components queued, %d bytes per tick\n"), SendSchedule.Num(), CurrentSettings.ScheduledBytesPerTick);
+	Report += FString::Printf(TEXT("Dormancy: %.1f s idle, %d dormant, %d awake, %lld sleeps, %lld wakes\n"),
+		CurrentSettings.DormancyIdleSeconds, NumDormantOwners, FMath::Max(InterestEntries.Num() - NumDormantOwners, 0), DormancySleeps, DormancyWakes);
+	Report += FString::Printf(TEXT("Event Fan-Out: %s, %lld events, %lld sends, %lld connections skipped\n"),
+		CurrentSettings.bEnableEventFanOut ? TEXT("Enabled") : TEXT("Disabled"), FanOutEvents, FanOutSends, FanOutSkippedConnections);
+	
+	// Performance thresholds
+	Report += FString::Printf(TEXT("Max Latency Threshold: %.2f ms\n"), MaxLatencyThreshold);
 	Report += FString::Printf(TEXT("Max Bandwidth Threshold: %.2f KB/s\n"), MaxBandwidthThreshold);
 	Report += FString::Printf(TEXT("Max Replications Threshold: %d\n"), MaxReplicationsThreshold);
 	
@@ -554,3 +1154,735 @@ void UNetworkReplicationSubsystem::ResetAllSimulations()
 	
 	UE_LOG(LogTemp, Log, TEXT("All network simulations reset"));
 }
+
+// ===== SESSION NAME DICTIONARY IMPLEMENTATIONS =====
+
+FReplicatedNameId UNetworkReplicationSubsystem::MakeReplicatedName(UWorld* World, FName Name)
+{
+	if (Name.IsNone() || !World || World->GetNetMode() == NM_Standalone)
+	{
+		return FReplicatedNameId(Name);
+	}
+
+	// Hardcoded engine names already replicate as a small integer
+	if (const EName* EngineName = Name.ToEName())
+	{
+		if (ShouldReplicateAsInteger(*EngineName, Name))
+		{
+			return FReplicatedNameId(Name);
+		}
+	}
+
+	if (World->GetNetMode() == NM_Client)
+	{
+		// Clients can only reuse ids the server has already replicated to them
+		const int32* KnownId = NameToId.Find(Name);
+		return KnownId ? FReplicatedNameId(*KnownId, Name) : FReplicatedNameId(Name);
+	}
+
+	ANetworkReplicationNameTable* Table = GetOrSpawnNameTable(World);
+	if (!Table)
+	{
+		return FReplicatedNameId(Name);
+	}
+
+	int32 NameId = INDEX_NONE;
+	if (const int32* ExistingId = NameToId.Find(Name))
+	{
+		NameId = *ExistingId;
+	}
+	else if (IdToName.Num() >= NetworkReplicationNames::MaxAssignedNames)
+	{
+		// The full name still works, it just costs more on the wire
+		UE_CLOG(!bWarnedNameTableFull, LogTemp, Warning, TEXT("Name table is full at %d names, new names are sent in full"), IdToName.Num());
+		bWarnedNameTableFull = true;
+		return FReplicatedNameId(Name);
+	}
+	else
+	{
+		NameId = IdToName.Add(Name);
+		NameToId.Add(Name, NameId);
+
+		// A full FName costs a length-prefixed string plus its number; an id is one packed varint
+		const int32 FullNameBytes = 4 + Name.GetStringLength() + 1 + 4;
+		int32 IdBytes = 1;
+		for (uint32 Remaining = static_cast<uint32>(NameId) >> 7; Remaining > 0; Remaining >>= 7)
+		{
+			IdBytes++;
+		}
+		NameIdSavings.Add(FullNameBytes - IdBytes);
+
+		Table->AddEntry(NameId, Name);
+	}
+
+	NameIdSends++;
+	NameIdBytesSavedEstimate += NameIdSavings[NameId];
+
+	return FReplicatedNameId(NameId, Name);
+}
+
+bool UNetworkReplicationSubsystem::ResolveReplicatedName(const FReplicatedNameId& NetName, FName& OutName) const
+{
+	if (!NetName.HasId())
+	{
+		OutName = NetName.Name;
+		return true;
+	}
+
+	if (IdToName.IsValidIndex(NetName.Id) && !IdToName[NetName.Id].IsNone())
+	{
+		OutName = IdToName[NetName.Id];
+		return true;
+	}
+
+	return false;
+}
+
+void UNetworkReplicationSubsystem::WaitForReplicatedName(UNetworkReplicationComponent* Component, int32 NameId)
+{
+	NameWaiters.Add(Component, NameId);
+}
+
+void UNetworkReplicationSubsystem::StopWaitingForReplicatedName(UNetworkReplicationComponent* Component)
+{
+	NameWaiters.Remove(Component);
+}
+
+void UNetworkReplicationSubsystem::RegisterReplicatedName(int32 NameId, FName Name)
+{
+	// Ids are assigned densely from zero, anything far outside that range is malformed
+	constexpr int32 MaxReplicatedNames = 1 << 20;
+	if (NameId < 0 || NameId >= MaxReplicatedNames)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Ignoring out of range name table id %d"), NameId);
+		return;
+	}
+
+	if (NameId >= IdToName.Num())
+	{
+		IdToName.SetNum(NameId + 1);
+	}
+	IdToName[NameId] = Name;
+	NameToId.Add(Name, NameId);
+
+	// Replaying may park or release other events, so the waiters are gathered before any of them runs
+	TArray<TWeakObjectPtr<UNetworkReplicationComponent>, TInlineAllocator<8>> Waiters;
+	for (auto It = NameWaiters.CreateIterator(); It; ++It)
+	{
+		if (!It->Key.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+		else if (It->Value == NameId)
+		{
+			Waiters.Add(It->Key);
+			It.RemoveCurrent();
+		}
+	}
+
+	for (const TWeakObjectPtr<UNetworkReplicationComponent>& Waiter : Waiters)
+	{
+		if (UNetworkReplicationComponent* Component = Waiter.Get())
+		{
+			Component->DispatchParkedNameEvents();
+		}
+	}
+}
+
+void UNetworkReplicationSubsystem::ResetReplicatedNames()
+{
+	NameToId.Reset();
+	IdToName.Reset();
+	NameWaiters.Reset();
+	bWarnedNameTableFull = false;
+}
+
+void UNetworkReplicationSubsystem::GetNameTableStats(int32& OutNameCount, int64& OutIdSends, int64& OutBytesSaved) const
+{
+	OutNameCount = IdToName.Num();
+	OutIdSends = NameIdSends;
+	OutBytesSaved = NameIdBytesSavedEstimate;
+}
+
+// ===== SERVER RPC RATE LIMITING IMPLEMENTATIONS =====
+
+bool UNetworkReplicationSubsystem::ConsumeRPCToken(UNetConnection* Connection, EReplicationRPCFamily Family)
+{
+	// Calls made locally on the server have no connection and are never limited
+	if (!Connection || CurrentSettings.MaxReplicationFrequency <= 0 || Family >= EReplicationRPCFamily::Count)
+	{
+		return true;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+
+	// Drop buckets of connections that have closed
+	if (Now - LastRPCBucketPruneTime > 10.0)
+	{
+		LastRPCBucketPruneTime = Now;
+		for (auto It = RPCTokenBuckets.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().ResolveObjectPtr())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	const double Capacity = FMath::Max(CurrentSettings.RPCBurstSize, 1);
+	FRPCTokenBucket& Bucket = RPCTokenBuckets.FindOrAdd(Connection).Buckets[static_cast<int32>(Family)];
+
+	if (Bucket.LastRefillTime == 0.0)
+	{
+		Bucket.Tokens = Capacity;
+	}
+	else
+	{
+		Bucket.Tokens = FMath::Min(Capacity, Bucket.Tokens + (Now - Bucket.LastRefillTime) * CurrentSettings.MaxReplicationFrequency);
+	}
+	Bucket.LastRefillTime = Now;
+
+	if (Bucket.Tokens < 1.0)
+	{
+		return false;
+	}
+
+	Bucket.Tokens -= 1.0;
+	return true;
+}
+
+bool UNetworkReplicationSubsystem::ShouldWarnUnknownName(UNetConnection* Connection)
+{
+	if (!Connection)
+	{
+		return true;
+	}
+
+	// Kept with the connection's buckets so it is pruned along with them
+	FConnectionRPCBuckets& Buckets = RPCTokenBuckets.FindOrAdd(Connection);
+	const bool bShouldWarn = !Buckets.bWarnedUnknownName;
+	Buckets.bWarnedUnknownName = true;
+	return bShouldWarn;
+}
+
+void UNetworkReplicationSubsystem::RecordRateLimitedRPC(EReplicationRPCFamily Family, bool bCoalesced)
+{
+	if (Family >= EReplicationRPCFamily::Count)
+	{
+		return;
+	}
+
+	if (bCoalesced)
+	{
+		RateLimitedCoalesced[static_cast<int32>(Family)]++;
+	}
+	else
+	{
+		RateLimitedDrops[static_cast<int32>(Family)]++;
+	}
+}
+
+void UNetworkReplicationSubsystem::GetRateLimitStats(EReplicationRPCFamily Family, int64& OutDropped, int64& OutCoalesced) const
+{
+	const bool bValidFamily = Family < EReplicationRPCFamily::Count;
+	OutDropped = bValidFamily ? RateLimitedDrops[static_cast<int32>(Family)] : 0;
+	OutCoalesced = bValidFamily ? RateLimitedCoalesced[static_cast<int32>(Family)] : 0;
+}
+
+// ===== SEND BUDGET IMPLEMENTATIONS =====
+
+bool UNetworkReplicationSubsystem::ConsumeSendBudget(AActor* Actor, int32 Bytes, EReplicationSendPriority Priority)
+{
+	UWorld* World = Actor ? Actor->GetWorld() : nullptr;
+	UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+	if (!NetDriver || !NetDriver->IsServer() || Bytes <= 0)
+	{
+		return true;
+	}
+
+	// A multicast only reaches connections that hold a channel for the actor; Iris has no channels, so it charges every connection
+	bool bAllConnections = false;
+#if UE_WITH_IRIS
+	bAllConnections = NetDriver->IsUsingIrisReplication();
+#endif
+
+	TArray<UNetConnection*, TInlineAllocator<16>> Recipients;
+	for (UNetConnection* Connection : NetDriver->ClientConnections)
+	{
+		if (Connection && (bAllConnections || Connection->FindActorChannelRef(Actor)))
+		{
+			Recipients.Add(Connection);
+		}
+	}
+
+	return ChargeConnections(Recipients, Bytes, Priority);
+}
+
+bool UNetworkReplicationSubsystem::ConsumeConnectionSendBudget(UNetConnection* Connection, int32 Bytes, EReplicationSendPriority Priority)
+{
+	if (!Connection || !Connection->Driver || !Connection->Driver->IsServer() || Bytes <= 0)
+	{
+		return true;
+	}
+
+	UNetConnection* Recipients[] = { Connection };
+	return ChargeConnections(Recipients, Bytes, Priority);
+}
+
+bool UNetworkReplicationSubsystem::ChargeConnections(TArrayView<UNetConnection* const> Connections, int32 Bytes, EReplicationSendPriority Priority)
+{
+	const double Rate = CurrentSettings.BandwidthLimitKB * 1024.0;
+	const double Capacity = Rate * FMath::Max(CurrentSettings.BandwidthBurstSeconds, 0.01f);
+	const bool bLimited = Rate > 0.0;
+
+	// One send cannot skip a recipient, so any recipient that has spent its budget holds it back.
+	// Cosmetics stop while a reserve is left, so gameplay events still find budget behind them.
+	if (bLimited && Priority != EReplicationSendPriority::Critical)
+	{
+		const double Threshold = Priority == EReplicationSendPriority::Low ? Capacity * FMath::Clamp(CurrentSettings.CosmeticBudgetReserve, 0.0f, 1.0f) : 0.0;
+		for (UNetConnection* Connection : Connections)
+		{
+			const double* Available = SendBudgets.Find(Connection);
+			if (Available && *Available <= Threshold)
+			{
+				return false;
+			}
+		}
+	}
+
+	for (UNetConnection* Connection : Connections)
+	{
+		if (bLimited)
+		{
+			// New connections start with a full burst; critical sends may overdraw by at most one burst
+			double* Available = SendBudgets.Find(Connection);
+			if (!Available)
+			{
+				Available = &SendBudgets.Add(Connection, Capacity);
+			}
+			*Available = FMath::Max(*Available - Bytes, -Capacity);
+		}
+
+		SendBudgetSpentBytes += Bytes;
+		BandwidthWindowBytes += Bytes;
+	}
+
+	return true;
+}
+
+void UNetworkReplicationSubsystem::RecordBudgetedBytes(int32 Bytes, bool bDropped)
+{
+	if (bDropped)
+	{
+		SendBudgetDroppedBytes += Bytes;
+	}
+	else
+	{
+		SendBudgetDeferredBytes += Bytes;
+	}
+}
+
+void UNetworkReplicationSubsystem::GetSendBudgetStats(int64& OutSpentBytes, int64& OutDeferredBytes, int64& OutDroppedBytes) const
+{
+	OutSpentBytes = SendBudgetSpentBytes;
+	OutDeferredBytes = SendBudgetDeferredBytes;
+	OutDroppedBytes = SendBudgetDroppedBytes;
+}
+
+void UNetworkReplicationSubsystem::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (!World || World->GetGameInstance() != GetGameInstance())
+	{
+		return;
+	}
+
+	// Refill every connection's budget and drop connections that have closed
+	const double Rate = CurrentSettings.BandwidthLimitKB * 1024.0;
+	const double Capacity = Rate * FMath::Max(CurrentSettings.BandwidthBurstSeconds, 0.01f);
+	for (auto It = SendBudgets.CreateIterator(); It; ++It)
+	{
+		UNetConnection* Connection = It.Key().ResolveObjectPtr();
+		if (!Connection || Connection->GetConnectionState() == USOCK_Closed)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+		It.Value() = FMath::Min(It.Value() + Rate * DeltaSeconds, Capacity);
+	}
+}
+
+// ===== SEND SCHEDULER IMPLEMENTATIONS =====
+
+void UNetworkReplicationSubsystem::ScheduleComponent(UNetworkReplicationComponent* Component)
+{
+	UWorld* World = Component ? Component->GetWorld() : nullptr;
+	if (!World)
+	{
+		return;
+	}
+
+	const float Priority = FMath::Max(GetComponentPriority(Component), KINDA_SMALL_NUMBER);
+	const float BaseInterval = FMath::Max(CurrentSettings.ReplicationInterval, KINDA_SMALL_NUMBER);
+
+	FScheduledComponent Entry;
+	Entry.SendDeadline = World->GetTimeSeconds() + BaseInterval / Priority;
+	Entry.Component = Component;
+	SendSchedule.HeapPush(Entry);
+}
+
+float UNetworkReplicationSubsystem::GetComponentPriority(const UNetworkReplicationComponent* Component) const
+{
+	if (!Component || !Component->GetOwner())
+	{
+		return 0.0f;
+	}
+
+	const float* ClassPriority = Component->ReplicationPriorityClass.IsNone() ? nullptr : CurrentSettings.PriorityClasses.Find(Component->ReplicationPriorityClass);
+	const float BasePriority = ClassPriority ? *ClassPriority : Component->ReplicationPriority;
+
+	UWorld* World = Component->GetWorld();
+	if (!World || !CurrentSettings.bEnableRelevancy || CurrentSettings.MaxReplicationDistance <= 0.0f)
+	{
+		return BasePriority;
+	}
+
+	// Scale down with distance to the nearest player, but never to zero so far components still age into a send
+	double NearestDistanceSquared = TNumericLimits<double>::Max();
+	const FInterestEntry* Entry = InterestEntries.Find(Component->GetOwner());
+	if (Entry && NearestViewerDistancesSquared.IsValidIndex(Entry->CacheIndex))
+	{
+		NearestDistanceSquared = NearestViewerDistancesSquared[Entry->CacheIndex];
+	}
+	else
+	{
+		// Registered since the last refresh
+		const FVector Location = Component->GetOwner()->GetActorLocation();
+		for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+		{
+			const APlayerController* PlayerController = It->Get();
+			const AActor* ViewTarget = PlayerController ? PlayerController->GetViewTarget() : nullptr;
+			if (ViewTarget)
+			{
+				NearestDistanceSquared = FMath::Min(NearestDistanceSquared, FVector::DistSquared(Location, ViewTarget->GetActorLocation()));
+			}
+		}
+	}
+
+	if (NearestDistanceSquared == TNumericLimits<double>::Max())
+	{
+		return BasePriority;
+	}
+
+	const float DistanceFactor = FMath::Clamp(1.0f - static_cast<float>(FMath::Sqrt(NearestDistanceSquared)) / CurrentSettings.MaxReplicationDistance, 0.1f, 1.0f);
+	return BasePriority * DistanceFactor;
+}
+
+int32 UNetworkReplicationSubsystem::GetScheduledComponentCount() const
+{
+	return SendSchedule.Num();
+}
+
+// ===== NET DORMANCY =====
+
+void UNetworkReplicationSubsystem::RecordDormancyTransition(bool bDormant)
+{
+	if (bDormant)
+	{
+		NumDormantOwners++;
+		DormancySleeps++;
+	}
+	else
+	{
+		NumDormantOwners = FMath::Max(NumDormantOwners - 1, 0);
+		DormancyWakes++;
+	}
+}
+
+void UNetworkReplicationSubsystem::ForgetDormantOwner()
+{
+	NumDormantOwners = FMath::Max(NumDormantOwners - 1, 0);
+}
+
+void UNetworkReplicationSubsystem::GetDormancyStats(int32& OutDormantOwners, int32& OutAwakeOwners, int64& OutSleeps, int64& OutWakes) const
+{
+	OutDormantOwners = NumDormantOwners;
+	OutAwakeOwners = FMath::Max(InterestEntries.Num() - NumDormantOwners, 0);
+	OutSleeps = DormancySleeps;
+	OutWakes = DormancyWakes;
+}
+
+// ===== EVENT FAN-OUT =====
+
+void UNetworkReplicationSubsystem::GatherEventAudience(const FVector& Location, float Radius, TArray<APlayerController*>& OutAudience) const
+{
+	OutAudience.Reset();
+	const float RadiusSquared = FMath::Square(Radius);
+	for (const FCachedViewer& Viewer : CachedViewers)
+	{
+		APlayerController* PlayerController = Viewer.PlayerController.Get();
+		if (PlayerController && FVector::DistSquared(Viewer.ViewLocation, Location) <= RadiusSquared)
+		{
+			OutAudience.Add(PlayerController);
+		}
+	}
+}
+
+UNetworkReplicationRelayComponent* UNetworkReplicationSubsystem::GetConnectionRelay(APlayerController* PlayerController)
+{
+	if (!PlayerController)
+	{
+		return nullptr;
+	}
+
+	TWeakObjectPtr<UNetworkReplicationRelayComponent>& Relay = ConnectionRelays.FindOrAdd(PlayerController);
+	if (Relay.IsValid())
+	{
+		return Relay.Get();
+	}
+
+	// Client RPCs on a component owned by the controller reach only that controller's connection.
+	// Always a dedicated relay, so game components on the controller never receive fanned out events
+	UNetworkReplicationRelayComponent* NewRelay = NewObject<UNetworkReplicationRelayComponent>(PlayerController, TEXT("NetworkReplicationRelay"));
+	NewRelay->RegisterComponent();
+	Relay = NewRelay;
+	return NewRelay;
+}
+
+void UNetworkReplicationSubsystem::RecordFanOut(int32 NumSends, int32 NumSkipped)
+{
+	FanOutEvents++;
+	FanOutSends += NumSends;
+	FanOutSkippedConnections += NumSkipped;
+}
+
+// ===== BATCH SPAWNING =====
+
+FReplicationSpawnBatchHandle UNetworkReplicationSubsystem::QueueSpawnBatch(UNetworkReplicationComponent* Requester, const TArray<FReplicationSpawnRequest>& Requests)
+{
+	if (!Requester)
+	{
+		return FReplicationSpawnBatchHandle();
+	}
+
+	// Skip zero when the counter wraps so a valid handle is never confused with an empty one
+	LastSpawnBatchId = LastSpawnBatchId == MAX_int32 ? 1 : LastSpawnBatchId + 1;
+
+	FPendingSpawnBatch& Batch = PendingSpawnBatches.AddDefaulted_GetRef();
+	Batch.Handle.Id = LastSpawnBatchId;
+	Batch.Requester = Requester;
+	Batch.Requests = Requests;
+	Batch.SpawnedActors.Reserve(Requests.Num());
+	return Batch.Handle;
+}
+
+bool UNetworkReplicationSubsystem::IsSpawnBatchPending(FReplicationSpawnBatchHandle Handle) const
+{
+	return FindSpawnBatch(Handle) != INDEX_NONE;
+}
+
+int32 UNetworkReplicationSubsystem::FindSpawnBatch(FReplicationSpawnBatchHandle Handle) const
+{
+	return PendingSpawnBatches.IndexOfByPredicate([Handle](const FPendingSpawnBatch& Batch) { return Batch.Handle == Handle; });
+}
+
+bool UNetworkReplicationSubsystem::CancelSpawnBatch(FReplicationSpawnBatchHandle Handle)
+{
+	const int32 BatchIndex = FindSpawnBatch(Handle);
+	if (BatchIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	EndSpawnBatch(BatchIndex, false);
+	return true;
+}
+
+void UNetworkReplicationSubsystem::EndSpawnBatch(int32 BatchIndex, bool bCompleted)
+{
+	const FPendingSpawnBatch& Batch = PendingSpawnBatches[BatchIndex];
+	const FReplicationSpawnBatchHandle Handle = Batch.Handle;
+	const TWeakObjectPtr<UNetworkReplicationComponent> Requester = Batch.Requester;
+
+	TArray<AActor*> SpawnedActors;
+	SpawnedActors.Reserve(Batch.SpawnedActors.Num());
+	for (const TWeakObjectPtr<AActor>& Actor : Batch.SpawnedActors)
+	{
+		SpawnedActors.Add(Actor.Get());
+	}
+
+	// Listeners may queue the next batch, so the finished one leaves the queue first
+	PendingSpawnBatches.RemoveAt(BatchIndex);
+	if (UNetworkReplicationComponent* RequesterToNotify = Requester.Get())
+	{
+		if (bCompleted)
+		{
+			RequesterToNotify->OnActorBatchSpawned.Broadcast(Handle, SpawnedActors);
+		}
+		else
+		{
+			RequesterToNotify->OnActorBatchCancelled.Broadcast(Handle, SpawnedActors);
+		}
+	}
+	OnSpawnBatchEnded.Broadcast(Handle, bCompleted, SpawnedActors);
+}
+
+void UNetworkReplicationSubsystem::ProcessSpawnBatches()
+{
+	int32 Budget = CurrentSettings.SpawnBatchActorsPerTick > 0 ? CurrentSettings.SpawnBatchActorsPerTick : MAX_int32;
+	while (PendingSpawnBatches.Num() > 0 && Budget > 0)
+	{
+		const FReplicationSpawnBatchHandle Handle = PendingSpawnBatches[0].Handle;
+		UNetworkReplicationComponent* Requester = PendingSpawnBatches[0].Requester.Get();
+		AActor* Owner = Requester ? Requester->GetOwner() : nullptr;
+		UWorld* World = Owner ? Owner->GetWorld() : nullptr;
+		if (!World)
+		{
+			// Nobody is left to own the actors, so only subsystem listeners hear about it
+			EndSpawnBatch(0, false);
+			continue;
+		}
+
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.Owner = Owner;
+		SpawnParameters.Instigator = Owner->GetInstigator();
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+		// SpawnActor runs BeginPlay, which may queue or cancel batches, so the batch is looked up again around every spawn
+		int32 BatchIndex = FindSpawnBatch(Handle);
+		while (BatchIndex != INDEX_NONE && Budget > 0)
+		{
+			const FPendingSpawnBatch& Batch = PendingSpawnBatches[BatchIndex];
+			if (Batch.SpawnedActors.Num() >= Batch.Requests.Num())
+			{
+				break;
+			}
+
+			const FReplicationSpawnRequest Request = Batch.Requests[Batch.SpawnedActors.Num()];
+			AActor* Actor = Request.ActorClass ? World->SpawnActor<AActor>(Request.ActorClass, Request.Transform, SpawnParameters) : nullptr;
+			BatchSpawnedActors += Actor ? 1 : 0;
+			Budget--;
+
+			BatchIndex = FindSpawnBatch(Handle);
+			if (BatchIndex != INDEX_NONE)
+			{
+				PendingSpawnBatches[BatchIndex].SpawnedActors.Add(Actor);
+			}
+		}
+
+		// Cancelled from inside a spawn; the actors it already made are kept
+		if (BatchIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const FPendingSpawnBatch& Batch = PendingSpawnBatches[BatchIndex];
+		if (Batch.SpawnedActors.Num() < Batch.Requests.Num())
+		{
+			return;
+		}
+
+		EndSpawnBatch(BatchIndex, true);
+	}
+}
+
+void UNetworkReplicationSubsystem::GetFanOutStats(int64& OutEvents, int64& OutSends, int64& OutSkippedConnections) const
+{
+	OutEvents = FanOutEvents;
+	OutSends = FanOutSends;
+	OutSkippedConnections = FanOutSkippedConnections;
+}
+
+void UNetworkReplicationSubsystem::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (SendSchedule.Num() == 0 || !World || World->GetGameInstance() != GetGameInstance())
+	{
+		return;
+	}
+
+	int32 RemainingBytes = CurrentSettings.ScheduledBytesPerTick > 0 ? CurrentSettings.ScheduledBytesPerTick : MAX_int32;
+
+	// Serve components in deadline order until the allowance runs out
+	TArray<FScheduledComponent, TInlineAllocator<16>> Parked;
+	while (RemainingBytes > 0 && SendSchedule.Num() > 0)
+	{
+		FScheduledComponent Entry;
+		SendSchedule.HeapPop(Entry, EAllowShrinking::No);
+
+		UNetworkReplicationComponent* Component = Entry.Component.Get();
+		if (!Component || !Component->HasQueuedEvents())
+		{
+			continue;
+		}
+
+		RemainingBytes -= Component->SendQueuedEvents(RemainingBytes);
+
+		// A component held back by its recipients' budgets does not hold back the others; it keeps its deadline so it goes first next tick
+		if (Component->HasQueuedEvents() && !Parked.ContainsByPredicate([Component](const FScheduledComponent& Other) { return Other.Component == Component; }))
+		{
+			Parked.Add(Entry);
+		}
+	}
+
+	for (const FScheduledComponent& Entry : Parked)
+	{
+		SendSchedule.HeapPush(Entry);
+	}
+}
+
+// ===== PAYLOAD COMPRESSION IMPLEMENTATIONS =====
+
+FReplicationCompressionStats UNetworkReplicationSubsystem::GetCompressionStats(EReplicationPayloadCategory Category) const
+{
+	if (Category >= EReplicationPayloadCategory::Count)
+	{
+		return FReplicationCompressionStats();
+	}
+	return PayloadCompressor.GetStats(Category);
+}
+
+void UNetworkReplicationSubsystem::StartCompressionCapture()
+{
+	PayloadCompressor.StartCapture();
+	UE_LOG(LogTemp, Log, TEXT("Compression sample capture started"));
+}
+
+bool UNetworkReplicationSubsystem::StopCompressionCapture(const FString& FilePath)
+{
+	const TArray<TArray<uint8>> Samples = PayloadCompressor.StopCapture();
+	const FString OutputPath = FilePath.IsEmpty() ? FPaths::ProjectSavedDir() / TEXT("NetworkReplication") / TEXT("CompressionSamples.bin") : FilePath;
+
+	if (!UNetworkReplicationCompressionDictionary::SaveSamples(OutputPath, Samples))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to write compression samples to: %s"), *OutputPath);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Wrote %d compression samples to: %s"), Samples.Num(), *OutputPath);
+	return true;
+}
+
+ANetworkReplicationNameTable* UNetworkReplicationSubsystem::GetOrSpawnNameTable(UWorld* World)
+{
+	ANetworkReplicationNameTable* Table = NameTableActor.Get();
+	if (Table && Table->GetWorld() == World)
+	{
+		return Table;
+	}
+
+	// Ids outlive map changes, so a table spawned for a new world starts with every entry
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.ObjectFlags |= RF_Transient;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	Table = World->SpawnActor<ANetworkReplicationNameTable>(SpawnParams);
+	if (Table)
+	{
+		for (int32 NameId = 0; NameId < IdToName.Num(); NameId++)
+		{
+			Table->AddEntry(NameId, IdToName[NameId]);
+		}
+	}
+
+	NameTableActor = Table;
+	return Table;
+}
@@ -0,0 +1,160 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationTransformCache.cpp
+// Implements the structure-of-arrays transform snapshot and its vectorized culling kernels.
+
+#include "NetworkReplicationTransformCache.h"
+#include "GameFramework/Actor.h"
+
+namespace NetworkReplicationTransformCache
+{
+	/** Padding lanes sit far enough away to always fail the test, yet square without overflowing a float */
+	static constexpr float PaddingCoordinate = 1.0e17f;
+}
+
+void FNetworkReplicationTransformCache::Reset(int32 ExpectedNum)
+{
+	const int32 Capacity = Align(ExpectedNum, LaneWidth);
+	X.Reset(Capacity);
+	Y.Reset(Capacity);
+	Z.Reset(Capacity);
+	Radii.Reset(Capacity);
+	Actors.Reset(ExpectedNum);
+	NumEntries = 0;
+}
+
+int32 FNetworkReplicationTransformCache::Add(AActor* Actor, const FVector& Location, float Radius)
+{
+	// Drop padding from an earlier Finalize so new entries stay contiguous
+	if (X.Num() != NumEntries)
+	{
+		X.SetNum(NumEntries, EAllowShrinking::No);
+		Y.SetNum(NumEntries, EAllowShrinking::No);
+		Z.SetNum(NumEntries, EAllowShrinking::No);
+		Radii.SetNum(NumEntries, EAllowShrinking::No);
+	}
+
+	X.Add(static_cast<float>(Location.X));
+	Y.Add(static_cast<float>(Location.Y));
+	Z.Add(static_cast<float>(Location.Z));
+	Radii.Add(Radius);
+	Actors.Add(Actor);
+	return NumEntries++;
+}
+
+void FNetworkReplicationTransformCache::Finalize()
+{
+	const int32 PaddedNum = Align(NumEntries, LaneWidth);
+	while (X.Num() < PaddedNum)
+	{
+		X.Add(NetworkReplicationTransformCache::PaddingCoordinate);
+		Y.Add(NetworkReplicationTransformCache::PaddingCoordinate);
+		Z.Add(NetworkReplicationTransformCache::PaddingCoordinate);
+		Radii.Add(0.0f);
+	}
+}
+
+void FNetworkReplicationTransformCache::CullSphere(const FVector& ViewLocation, float CullDistance, TArray<uint32>& OutMask, TArray<float>& OutDistancesSquared) const
+{
+	checkf(X.Num() % LaneWidth == 0, TEXT("Finalize the transform cache before culling"));
+
+	OutMask.Reset();
+	OutMask.SetNumZeroed(NumMaskWords(NumEntries));
+	OutDistancesSquared.SetNumUninitialized(X.Num(), EAllowShrinking::No);
+
+	const VectorRegister4Float ViewX = VectorSetFloat1(static_cast<float>(ViewLocation.X));
+	const VectorRegister4Float ViewY = VectorSetFloat1(static_cast<float>(ViewLocation.Y));
+	const VectorRegister4Float ViewZ = VectorSetFloat1(static_cast<float>(ViewLocation.Z));
+	const VectorRegister4Float Distance = VectorSetFloat1(CullDistance);
+
+	const float* RESTRICT XData = X.GetData();
+	const float* RESTRICT YData = Y.GetData();
+	const float* RESTRICT ZData = Z.GetData();
+	const float* RESTRICT RadiusData = Radii.GetData();
+	float* RESTRICT DistanceData = OutDistancesSquared.GetData();
+	uint32* RESTRICT MaskData = OutMask.GetData();
+
+	for (int32 Index = 0; Index < X.Num(); Index += LaneWidth)
+	{
+		const VectorRegister4Float DeltaX = VectorSubtract(VectorLoadAligned(XData + Index), ViewX);
+		const VectorRegister4Float DeltaY = VectorSubtract(VectorLoadAligned(YData + Index), ViewY);
+		const VectorRegister4Float DeltaZ = VectorSubtract(VectorLoadAligned(ZData + Index), ViewZ);
+
+		VectorRegister4Float DistanceSquared = VectorMultiply(DeltaX, DeltaX);
+		DistanceSquared = VectorMultiplyAdd(DeltaY, DeltaY, DistanceSquared);
+		DistanceSquared = VectorMultiplyAdd(DeltaZ, DeltaZ, DistanceSquared);
+
+		const VectorRegister4Float Reach = VectorAdd(Distance, VectorLoadAligned(RadiusData + Index));
+		const uint32 LaneBits = static_cast<uint32>(VectorMaskBits(VectorCompareLE(DistanceSquared, VectorMultiply(Reach, Reach))));
+
+		// Four lanes never straddle a 32-bit mask word
+		MaskData[Index >> 5] |= LaneBits << (Index & 31);
+		VectorStore(DistanceSquared, DistanceData + Index);
+	}
+
+	// A large enough cull distance reaches even the padding lanes
+	if (const int32 NumTailBits = NumEntries & 31)
+	{
+		MaskData[NumEntries >> 5] &= (1u << NumTailBits) - 1;
+	}
+
+	OutDistancesSquared.SetNum(NumEntries, EAllowShrinking::No);
+}
+
+void FNetworkReplicationTransformCache::CullSphereScalar(const FVector& ViewLocation, float CullDistance, TArray<uint32>& OutMask, TArray<float>& OutDistancesSquared) const
+{
+	OutMask.Reset();
+	OutMask.SetNumZeroed(NumMaskWords(NumEntries));
+	OutDistancesSquared.SetNumUninitialized(NumEntries, EAllowShrinking::No);
+
+	const float ViewX = static_cast<float>(ViewLocation.X);
+	const float ViewY = static_cast<float>(ViewLocation.Y);
+	const float ViewZ = static_cast<float>(ViewLocation.Z);
+
+	for (int32 Index = 0; Index < NumEntries; Index++)
+	{
+		const float DistanceSquared = FMath::Square(X[Index] - ViewX) + FMath::Square(Y[Index] - ViewY) + FMath::Square(Z[Index] - ViewZ);
+		if (DistanceSquared <= FMath::Square(CullDistance + Radii[Index]))
+		{
+			OutMask[Index >> 5] |= 1u << (Index & 31);
+		}
+		OutDistancesSquared[Index] = DistanceSquared;
+	}
+}
+
+void FNetworkReplicationTransformCache::AccumulateNearestDistanceSquared(const FVector& ViewLocation, TArray<float>& InOutNearestSquared) const
+{
+	checkf(X.Num() % LaneWidth == 0, TEXT("Finalize the transform cache before culling"));
+	check(InOutNearestSquared.Num() == NumEntries);
+
+	const VectorRegister4Float ViewX = VectorSetFloat1(static_cast<float>(ViewLocation.X));
+	const VectorRegister4Float ViewY = VectorSetFloat1(static_cast<float>(ViewLocation.Y));
+	const VectorRegister4Float ViewZ = VectorSetFloat1(static_cast<float>(ViewLocation.Z));
+
+	const float* RESTRICT XData = X.GetData();
+	const float* RESTRICT YData = Y.GetData();
+	const float* RESTRICT ZData = Z.GetData();
+	float* RESTRICT NearestData = InOutNearestSquared.GetData();
+
+	// The output is not padded, so whole lanes go through the vector path and the tail is done one entry at a time
+	const int32 NumVectorEntries = NumEntries - NumEntries % LaneWidth;
+	int32 Index = 0;
+	for (; Index < NumVectorEntries; Index += LaneWidth)
+	{
+		const VectorRegister4Float DeltaX = VectorSubtract(VectorLoadAligned(XData + Index), ViewX);
+		const VectorRegister4Float DeltaY = VectorSubtract(VectorLoadAligned(YData + Index), ViewY);
+		const VectorRegister4Float DeltaZ = VectorSubtract(VectorLoadAligned(ZData + Index), ViewZ);
+
+		VectorRegister4Float DistanceSquared = VectorMultiply(DeltaX, DeltaX);
+		DistanceSquared = VectorMultiplyAdd(DeltaY, DeltaY, DistanceSquared);
+		DistanceSquared = VectorMultiplyAdd(DeltaZ, DeltaZ, DistanceSquared);
+
+		VectorStore(VectorMin(VectorLoad(NearestData + Index), DistanceSquared), NearestData + Index);
+	}
+
+	for (; Index < NumEntries; Index++)
+	{
+		const float DistanceSquared = FMath::Square(XData[Index] - static_cast<float>(ViewLocation.X)) + FMath::Square(YData[Index] - static_cast<float>(ViewLocation.Y)) + FMath::Square(ZData[Index] - static_cast<float>(ViewLocation.Z));
+		NearestData[Index] = FMath::Min(NearestData[Index], DistanceSquared);
+	}
+}
@@ -0,0 +1,754 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationTypes.cpp
+// Implements serialization helpers for the network replication types.
+
+#include "NetworkReplicationTypes.h"
+#include "NetworkReplicationComponent.h"
+#include "NetworkReplicationCompression.h"
+#include "UObject/CoreNet.h"
+
+// ===== QUANTIZATION =====
+
+namespace NetworkReplicationQuantization
+{
+	/** Octahedral fold for unit vectors in the lower hemisphere, shared by encode and decode */
+	static void FoldOctahedron(double& U, double& V)
+	{
+		const double OldU = U;
+		U = (1.0 - FMath::Abs(V)) * (OldU >= 0.0 ? 1.0 : -1.0);
+		V = (1.0 - FMath::Abs(OldU)) * (V >= 0.0 ? 1.0 : -1.0);
+	}
+}
+
+void FQuantizedValue::SerializePacked(FArchive& Ar)
+{
+	uint32 ModeValue = static_cast<uint32>(Mode);
+	Ar.SerializeInt(ModeValue, static_cast<uint32>(EReplicationQuantizationMode::Count));
+
+	uint32 BitsMinusOne = BitsPerComponent > 0 ? BitsPerComponent - 1 : 0;
+	Ar.SerializeInt(BitsMinusOne, 32);
+
+	uint32 Components = NumComponents;
+	Ar.SerializeInt(Components, 4);
+
+	if (Ar.IsLoading())
+	{
+		Mode = static_cast<EReplicationQuantizationMode>(ModeValue);
+		BitsPerComponent = static_cast<uint8>(BitsMinusOne + 1);
+		NumComponents = static_cast<uint8>(Components);
+
+		if (Mode == EReplicationQuantizationMode::None || NumComponents == 0)
+		{
+			Ar.SetError();
+			return;
+		}
+	}
+
+	for (int32 Index = 0; Index < NumComponents; Index++)
+	{
+		if (Ar.IsLoading())
+		{
+			Packed[Index] = 0;
+		}
+		Ar.SerializeBits(&Packed[Index], BitsPerComponent);
+	}
+}
+
+int32 FQuantizedValue::GetEstimatedWireBytes() const
+{
+	// Header is mode, bit width and component count; raw values are three floats
+	return IsQuantized() ? 2 + (BitsPerComponent * NumComponents + 7) / 8 : ReplicationWireSize::Vector;
+}
+
+bool FQuantizedValue::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint8 QuantizedBit = IsQuantized() ? 1 : 0;
+	Ar.SerializeBits(&QuantizedBit, 1);
+
+	if (QuantizedBit & 1)
+	{
+		SerializePacked(Ar);
+	}
+	else
+	{
+		Mode = EReplicationQuantizationMode::None;
+		FVector3f Value3f(Value);
+		Ar << Value3f.X << Value3f.Y << Value3f.Z;
+		Value = FVector(Value3f);
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+bool FReplicationQuantizationRule::Quantize(const FVector& Value, int32 NumComponents, FQuantizedValue& OutValue) const
+{
+	if (Mode == EReplicationQuantizationMode::None || BitsPerComponent < 1 || BitsPerComponent > 32)
+	{
+		return false;
+	}
+
+	// Normals only make sense for full vectors
+	if (Mode == EReplicationQuantizationMode::UnitNormal && NumComponents != 3)
+	{
+		return false;
+	}
+
+	OutValue.Mode = Mode;
+	OutValue.BitsPerComponent = static_cast<uint8>(BitsPerComponent);
+
+	if (Mode == EReplicationQuantizationMode::UnitNormal)
+	{
+		FVector Normal = Value.GetSafeNormal();
+		if (Normal.IsZero())
+		{
+			Normal = FVector::UpVector;
+		}
+
+		const double L1Norm = FMath::Abs(Normal.X) + FMath::Abs(Normal.Y) + FMath::Abs(Normal.Z);
+		double U = Normal.X / L1Norm;
+		double V = Normal.Y / L1Norm;
+		if (Normal.Z < 0.0)
+		{
+			NetworkReplicationQuantization::FoldOctahedron(U, V);
+		}
+
+		OutValue.NumComponents = 2;
+		OutValue.Packed[0] = QuantizeComponent(U);
+		OutValue.Packed[1] = QuantizeComponent(V);
+		OutValue.Packed[2] = 0;
+	}
+	else
+	{
+		OutValue.NumComponents = static_cast<uint8>(FMath::Clamp(NumComponents, 1, 3));
+		for (int32 Index = 0; Index < 3; Index++)
+		{
+			OutValue.Packed[Index] = Index < OutValue.NumComponents ? QuantizeComponent(Value[Index]) : 0;
+		}
+	}
+
+	// The sender keeps the value receivers will decode so local state matches remote state
+	OutValue.Value = Dequantize(OutValue);
+	return true;
+}
+
+FVector FReplicationQuantizationRule::Dequantize(const FQuantizedValue& Value) const
+{
+	if (Value.Mode != Mode)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Quantized value mode %d does not match rule mode %d"), static_cast<int32>(Value.Mode), static_cast<int32>(Mode));
+		return FVector::ZeroVector;
+	}
+
+	// Use the bit width recorded on the wire, so a profile edit cannot misread older packets
+	FReplicationQuantizationRule WireRule = *this;
+	WireRule.BitsPerComponent = Value.BitsPerComponent;
+
+	if (Mode == EReplicationQuantizationMode::UnitNormal)
+	{
+		double U = WireRule.DequantizeComponent(Value.Packed[0]);
+		double V = WireRule.DequantizeComponent(Value.Packed[1]);
+		const double Z = 1.0 - FMath::Abs(U) - FMath::Abs(V);
+		if (Z < 0.0)
+		{
+			NetworkReplicationQuantization::FoldOctahedron(U, V);
+		}
+		return FVector(U, V, Z).GetSafeNormal();
+	}
+
+	FVector Result = FVector::ZeroVector;
+	for (int32 Index = 0; Index < Value.NumComponents && Index < 3; Index++)
+	{
+		Result[Index] = WireRule.DequantizeComponent(Value.Packed[Index]);
+	}
+	return Result;
+}
+
+uint32 FReplicationQuantizationRule::QuantizeComponent(double Component) const
+{
+	const uint64 NumSteps = uint64(1) << BitsPerComponent;
+	const double MaxPacked = static_cast<double>(NumSteps - 1);
+
+	switch (Mode)
+	{
+	case EReplicationQuantizationMode::FixedPoint:
+	{
+		// Signed steps are offset by half the range so they pack as unsigned
+		const double Steps = FMath::RoundToDouble(Component / FMath::Max(Scale, UE_KINDA_SMALL_NUMBER));
+		return static_cast<uint32>(FMath::Clamp(Steps + static_cast<double>(NumSteps >> 1), 0.0, MaxPacked));
+	}
+	case EReplicationQuantizationMode::Range:
+	{
+		const double Span = RangeMax - RangeMin;
+		const double Alpha = Span > 0.0 ? FMath::Clamp((Component - RangeMin) / Span, 0.0, 1.0) : 0.0;
+		return static_cast<uint32>(FMath::RoundToDouble(Alpha * MaxPacked));
+	}
+	case EReplicationQuantizationMode::UnitNormal:
+	{
+		const double Alpha = FMath::Clamp((Component + 1.0) * 0.5, 0.0, 1.0);
+		return static_cast<uint32>(FMath::RoundToDouble(Alpha * MaxPacked));
+	}
+	case EReplicationQuantizationMode::Angle:
+	{
+		const double Steps = FMath::RoundToDouble(FRotator::ClampAxis(Component) / 360.0 * static_cast<double>(NumSteps));
+		return static_cast<uint32>(static_cast<uint64>(Steps) & (NumSteps - 1));
+	}
+	default:
+		return 0;
+	}
+}
+
+double FReplicationQuantizationRule::DequantizeComponent(uint32 Packed) const
+{
+	const uint64 NumSteps = uint64(1) << BitsPerComponent;
+	const double MaxPacked = static_cast<double>(NumSteps - 1);
+
+	switch (Mode)
+	{
+	case EReplicationQuantizationMode::FixedPoint:
+		return (static_cast<double>(Packed) - static_cast<double>(NumSteps >> 1)) * FMath::Max(Scale, UE_KINDA_SMALL_NUMBER);
+	case EReplicationQuantizationMode::Range:
+		return RangeMin + (static_cast<double>(Packed) / MaxPacked) * (RangeMax - RangeMin);
+	case EReplicationQuantizationMode::UnitNormal:
+		return (static_cast<double>(Packed) / MaxPacked) * 2.0 - 1.0;
+	case EReplicationQuantizationMode::Angle:
+		return static_cast<double>(Packed) * 360.0 / static_cast<double>(NumSteps);
+	default:
+		return 0.0;
+	}
+}
+
+// ===== REPLICATED VARIABLE VALUE =====
+
+FReplicatedVariableValue FReplicatedVariableValue::MakeString(const FString& Value)
+{
+	FReplicatedVariableValue Result;
+	Result.Type = EReplicatedVariableType::String;
+	Result.StringValue = Value;
+	return Result;
+}
+
+FReplicatedVariableValue FReplicatedVariableValue::MakeFloat(float Value)
+{
+	FReplicatedVariableValue Result;
+	Result.Type = EReplicatedVariableType::Float;
+	Result.FloatValue = Value;
+	return Result;
+}
+
+FReplicatedVariableValue FReplicatedVariableValue::MakeInt(int32 Value)
+{
+	FReplicatedVariableValue Result;
+	Result.Type = EReplicatedVariableType::Int;
+	Result.IntValue = Value;
+	return Result;
+}
+
+FReplicatedVariableValue FReplicatedVariableValue::MakeBool(bool Value)
+{
+	FReplicatedVariableValue Result;
+	Result.Type = EReplicatedVariableType::Bool;
+	Result.BoolValue = Value;
+	return Result;
+}
+
+FReplicatedVariableValue FReplicatedVariableValue::MakeVector(const FVector& Value)
+{
+	FReplicatedVariableValue Result;
+	Result.Type = EReplicatedVariableType::Vector;
+	Result.VectorValue = Value;
+	return Result;
+}
+
+FString FReplicatedVariableValue::ToString() const
+{
+	switch (Type)
+	{
+	case EReplicatedVariableType::String:
+		return StringValue;
+	case EReplicatedVariableType::Float:
+		return FString::Printf(TEXT("%.6f"), FloatValue);
+	case EReplicatedVariableType::Int:
+		return FString::Printf(TEXT("%d"), IntValue);
+	case EReplicatedVariableType::Bool:
+		return BoolValue ? TEXT("true") : TEXT("false");
+	case EReplicatedVariableType::Vector:
+		return VectorValue.ToString();
+	default:
+		return FString();
+	}
+}
+
+bool FReplicatedVariableValue::Equals(const FReplicatedVariableValue& Other) const
+{
+	if (Type != Other.Type)
+	{
+		return false;
+	}
+
+	switch (Type)
+	{
+	case EReplicatedVariableType::String:
+		return StringValue.Equals(Other.StringValue, ESearchCase::CaseSensitive);
+	case EReplicatedVariableType::Float:
+		return FloatValue == Other.FloatValue;
+	case EReplicatedVariableType::Int:
+		return IntValue == Other.IntValue;
+	case EReplicatedVariableType::Bool:
+		return BoolValue == Other.BoolValue;
+	case EReplicatedVariableType::Vector:
+		return VectorValue == Other.VectorValue;
+	default:
+		return true;
+	}
+}
+
+int32 FReplicatedVariableValue::GetEstimatedWireBytes() const
+{
+	switch (Type)
+	{
+	case EReplicatedVariableType::String:
+		return 5 + StringValue.Len();
+	case EReplicatedVariableType::Float:
+		return Quantized.IsQuantized() ? 1 + Quantized.GetEstimatedWireBytes() : 5;
+	case EReplicatedVariableType::Int:
+		return 5;
+	case EReplicatedVariableType::Bool:
+		return 1;
+	case EReplicatedVariableType::Vector:
+		return 1 + Quantized.GetEstimatedWireBytes();
+	default:
+		return 1;
+	}
+}
+
+bool FReplicatedVariableValue::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint32 TypeValue = static_cast<uint32>(Type);
+	Ar.SerializeInt(TypeValue, static_cast<uint32>(EReplicatedVariableType::Count));
+	Type = static_cast<EReplicatedVariableType>(TypeValue);
+
+	switch (Type)
+	{
+	case EReplicatedVariableType::String:
+		Ar << StringValue;
+		break;
+	case EReplicatedVariableType::Float:
+	{
+		uint8 QuantizedBit = Quantized.IsQuantized() ? 1 : 0;
+		Ar.SerializeBits(&QuantizedBit, 1);
+		if (QuantizedBit & 1)
+		{
+			// Receivers decode through their quantization profile
+			Quantized.SerializePacked(Ar);
+		}
+		else
+		{
+			Quantized.Mode = EReplicationQuantizationMode::None;
+			Ar << FloatValue;
+		}
+		break;
+	}
+	case EReplicatedVariableType::Int:
+		Ar << IntValue;
+		break;
+	case EReplicatedVariableType::Bool:
+	{
+		uint8 BoolBit = BoolValue ? 1 : 0;
+		Ar.SerializeBits(&BoolBit, 1);
+		BoolValue = (BoolBit & 1) != 0;
+		break;
+	}
+	case EReplicatedVariableType::Vector:
+	{
+		uint8 QuantizedBit = Quantized.IsQuantized() ? 1 : 0;
+		Ar.SerializeBits(&QuantizedBit, 1);
+		if (QuantizedBit & 1)
+		{
+			Quantized.SerializePacked(Ar);
+		}
+		else
+		{
+			// Single precision is plenty for gameplay variables and halves the payload
+			Quantized.Mode = EReplicationQuantizationMode::None;
+			FVector3f Vector3f(VectorValue);
+			Ar << Vector3f.X << Vector3f.Y << Vector3f.Z;
+			VectorValue = FVector(Vector3f);
+		}
+		break;
+	}
+	default:
+		bOutSuccess = false;
+		return true;
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+// ===== CHANGE DETECTION =====
+
+bool FReplicatedVariableThreshold::IsUnchanged(const FReplicatedVariableValue& Previous, const FReplicatedVariableValue& Candidate) const
+{
+	if (Previous.Type != Candidate.Type)
+	{
+		return false;
+	}
+
+	switch (Candidate.Type)
+	{
+	case EReplicatedVariableType::Float:
+	{
+		const float Tolerance = FMath::Max(AbsoluteEpsilon, RelativeEpsilon * FMath::Max(FMath::Abs(Previous.FloatValue), FMath::Abs(Candidate.FloatValue)));
+		return FMath::Abs(Candidate.FloatValue - Previous.FloatValue) <= Tolerance;
+	}
+	case EReplicatedVariableType::Int:
+	{
+		const double Tolerance = FMath::Max<double>(AbsoluteEpsilon, RelativeEpsilon * FMath::Max(FMath::Abs<double>(Previous.IntValue), FMath::Abs<double>(Candidate.IntValue)));
+		return FMath::Abs(static_cast<double>(Candidate.IntValue) - Previous.IntValue) <= Tolerance;
+	}
+	case EReplicatedVariableType::Vector:
+	{
+		const double Tolerance = FMath::Max<double>(AbsoluteEpsilon, RelativeEpsilon * FMath::Max(Previous.VectorValue.Size(), Candidate.VectorValue.Size()));
+		return FVector::DistSquared(Previous.VectorValue, Candidate.VectorValue) <= FMath::Square(Tolerance);
+	}
+	default:
+		return Previous.Equals(Candidate);
+	}
+}
+
+// ===== SESSION NAME DICTIONARY =====
+
+int32 FReplicatedNameId::GetEstimatedWireBytes() const
+{
+	// Ids are a packed varint, full names a length-prefixed string plus their number
+	return HasId() ? 2 : 4 + Name.GetStringLength() + 1 + 4;
+}
+
+bool FReplicatedNameId::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint8 HasIdBit = HasId() ? 1 : 0;
+	Ar.SerializeBits(&HasIdBit, 1);
+
+	if (HasIdBit & 1)
+	{
+		uint32 PackedId = static_cast<uint32>(Id);
+		Ar.SerializeIntPacked(PackedId);
+		Id = static_cast<int32>(PackedId);
+
+		if (Ar.IsLoading())
+		{
+			Name = NAME_None;
+		}
+	}
+	else
+	{
+		Id = INDEX_NONE;
+		Ar << Name;
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+// ===== PERSISTENT VARIABLE STORE =====
+
+void FReplicatedVariableItem::PostReplicatedAdd(const FReplicatedVariableArray& InArraySerializer)
+{
+	if (InArraySerializer.OwnerComponent)
+	{
+		InArraySerializer.OwnerComponent->HandleStoreItemReplicated(InArraySerializer, VariableName, Value, SourceSequence);
+	}
+}
+
+void FReplicatedVariableItem::PostReplicatedChange(const FReplicatedVariableArray& InArraySerializer)
+{
+	if (InArraySerializer.OwnerComponent)
+	{
+		InArraySerializer.OwnerComponent->HandleStoreItemReplicated(InArraySerializer, VariableName, Value, SourceSequence);
+	}
+}
+
+int32 FReplicatedVariableArray::FindItemIndex(FName VariableName) const
+{
+	const int32* Index = ItemIndices.Find(VariableName);
+	if (Index && Items.IsValidIndex(*Index) && Items[*Index].VariableName == VariableName)
+	{
+		return *Index;
+	}
+
+	// A map that covers every item is current, so a miss means the name is not stored
+	if (!Index && ItemIndices.Num() == Items.Num())
+	{
+		return INDEX_NONE;
+	}
+
+	ItemIndices.Reset();
+	ItemIndices.Reserve(Items.Num());
+	for (int32 ItemIndex = 0; ItemIndex < Items.Num(); ItemIndex++)
+	{
+		ItemIndices.Add(Items[ItemIndex].VariableName, ItemIndex);
+	}
+
+	Index = ItemIndices.Find(VariableName);
+	return Index ? *Index : INDEX_NONE;
+}
+
+const FReplicatedVariableValue* FReplicatedVariableArray::FindValue(FName VariableName) const
+{
+	const int32 Index = FindItemIndex(VariableName);
+	return Index != INDEX_NONE ? &Items[Index].Value : nullptr;
+}
+
+bool FReplicatedVariableArray::SetValue(FName VariableName, const FReplicatedVariableValue& Value, uint16 SourceSequence)
+{
+	const int32 Index = FindItemIndex(VariableName);
+	if (Index != INDEX_NONE)
+	{
+		FReplicatedVariableItem& Item = Items[Index];
+		if (Item.Value.Equals(Value))
+		{
+			return false;
+		}
+
+		Item.Value = Value;
+		Item.SourceSequence = SourceSequence;
+		MarkItemDirty(Item);
+		return true;
+	}
+
+	ItemIndices.Add(VariableName, Items.Num());
+	FReplicatedVariableItem& NewItem = Items.AddDefaulted_GetRef();
+	NewItem.VariableName = VariableName;
+	NewItem.Value = Value;
+	NewItem.SourceSequence = SourceSequence;
+	MarkItemDirty(NewItem);
+	return true;
+}
+
+// ===== EVENT BATCHING =====
+
+EReplicationSendPriority FReplicationBatchedEvent::GetSendPriority() const
+{
+	switch (Type)
+	{
+	case EReplicationEventType::Sound:
+	case EReplicationEventType::SoundAtLocation:
+	case EReplicationEventType::NiagaraEffect:
+		return EReplicationSendPriority::Low;
+	default:
+		return EReplicationSendPriority::Normal;
+	}
+}
+
+int32 FReplicationBatchedEvent::GetEstimatedWireBytes() const
+{
+	int32 Bytes = ReplicationWireSize::RPCHeader;
+
+	switch (Type)
+	{
+	case EReplicationEventType::Sound:
+		Bytes += ReplicationWireSize::ObjectReference + 12;
+		break;
+	case EReplicationEventType::SoundAtLocation:
+		Bytes += ReplicationWireSize::ObjectReference + QuantizedLocation.GetEstimatedWireBytes() + 12;
+		break;
+	case EReplicationEventType::NiagaraEffect:
+		Bytes += ReplicationWireSize::ObjectReference + ReplicationWireSize::Vector + ReplicationWireSize::Rotator + 1 + Name.GetEstimatedWireBytes();
+		break;
+	case EReplicationEventType::Variable:
+		Bytes += Name.GetEstimatedWireBytes() + Value.GetEstimatedWireBytes();
+		break;
+	case EReplicationEventType::CustomEvent:
+		Bytes += Name.GetEstimatedWireBytes() + 5 + Data.Len();
+		break;
+	case EReplicationEventType::StructEvent:
+	{
+		const UScriptStruct* ScriptStruct = Payload.GetScriptStruct();
+		Bytes += Name.GetEstimatedWireBytes() + ReplicationWireSize::ObjectReference + (ScriptStruct ? ScriptStruct->GetStructureSize() : 0);
+		break;
+	}
+	default:
+		break;
+	}
+
+	return Bytes;
+}
+
+bool FReplicationBatchedEvent::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint32 TypeValue = static_cast<uint32>(Type);
+	Ar.SerializeInt(TypeValue, static_cast<uint32>(EReplicationEventType::Count));
+	Type = static_cast<EReplicationEventType>(TypeValue);
+
+	bOutSuccess = true;
+
+	switch (Type)
+	{
+	case EReplicationEventType::Sound:
+	case EReplicationEventType::SoundAtLocation:
+	{
+		UObject* SoundObject = Asset;
+		bOutSuccess &= Map && Map->SerializeObject(Ar, USoundBase::StaticClass(), SoundObject);
+		Asset = SoundObject;
+
+		if (Type == EReplicationEventType::SoundAtLocation)
+		{
+			bool bLocationSuccess = true;
+			QuantizedLocation.NetSerialize(Ar, Map, bLocationSuccess);
+			bOutSuccess &= bLocationSuccess;
+		}
+
+		Ar << VolumeMultiplier << PitchMultiplier << StartTime;
+		break;
+	}
+	case EReplicationEventType::NiagaraEffect:
+	{
+		UObject* EffectObject = Asset;
+		bOutSuccess &= Map && Map->SerializeObject(Ar, UNiagaraSystem::StaticClass(), EffectObject);
+		Asset = EffectObject;
+
+		FVector3f Location3f(Location);
+		Ar << Location3f.X << Location3f.Y << Location3f.Z;
+		Location = FVector(Location3f);
+		Rotation.SerializeCompressedShort(Ar);
+
+		uint8 AttachBit = bAttachToOwner ? 1 : 0;
+		Ar.SerializeBits(&AttachBit, 1);
+		bAttachToOwner = (AttachBit & 1) != 0;
+
+		bool bNameSuccess = true;
+		Name.NetSerialize(Ar, Map, bNameSuccess);
+		bOutSuccess &= bNameSuccess;
+		break;
+	}
+	case EReplicationEventType::Variable:
+	{
+		bool bNameSuccess = true;
+		Name.NetSerialize(Ar, Map, bNameSuccess);
+		bool bValueSuccess = true;
+		Value.NetSerialize(Ar, Map, bValueSuccess);
+		bOutSuccess &= bNameSuccess && bValueSuccess;
+		break;
+	}
+	case EReplicationEventType::CustomEvent:
+	{
+		bool bNameSuccess = true;
+		Name.NetSerialize(Ar, Map, bNameSuccess);
+		bOutSuccess &= bNameSuccess;
+		Ar << Data;
+		break;
+	}
+	case EReplicationEventType::StructEvent:
+	{
+		bool bNameSuccess = true;
+		Name.NetSerialize(Ar, Map, bNameSuccess);
+		bool bPayloadSuccess = true;
+		Payload.NetSerialize(Ar, Map, bPayloadSuccess);
+		bOutSuccess &= bNameSuccess && bPayloadSuccess;
+		break;
+	}
+	default:
+		bOutSuccess = false;
+		return true;
+	}
+
+	bOutSuccess &= !Ar.IsError();
+	return true;
+}
+
+bool FReplicationEventBatch::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	// Events are encoded into their own buffer first so the whole batch can be compressed at once
+	TArray<uint8> Buffer;
+	int64 NumBits = 0;
+
+	if (Ar.IsSaving())
+	{
+		FNetBitWriter Writer(Map, 1024 * 8);
+		Writer.SetEngineNetVer(Ar.EngineNetVer());
+		Writer.SetGameNetVer(Ar.GameNetVer());
+
+		bOutSuccess = SerializeEvents(Writer, Map);
+		Buffer = MoveTemp(*Writer.GetBuffer());
+		NumBits = Writer.GetNumBits();
+	}
+
+	FNetworkReplicationCompressor::SerializePayload(Ar, Map, EReplicationPayloadCategory::EventBatch, Buffer, NumBits);
+
+	if (Ar.IsLoading())
+	{
+		if (Ar.IsError())
+		{
+			bOutSuccess = false;
+			return true;
+		}
+
+		FNetBitReader Reader(Map, Buffer.GetData(), NumBits);
+		Reader.SetEngineNetVer(Ar.EngineNetVer());
+		Reader.SetGameNetVer(Ar.GameNetVer());
+
+		bOutSuccess = SerializeEvents(Reader, Map);
+	}
+
+	bOutSuccess &= !Ar.IsError();
+	return true;
+}
+
+bool FReplicationEventBatch::SerializeEvents(FArchive& Ar, UPackageMap* Map)
+{
+	uint32 NumEvents = Events.Num();
+	Ar.SerializeIntPacked(NumEvents);
+
+	if (Ar.IsLoading())
+	{
+		if (NumEvents > MaxEvents)
+		{
+			Ar.SetError();
+			return false;
+		}
+		Events.SetNum(NumEvents);
+	}
+
+	bool bSuccess = true;
+	for (FReplicationBatchedEvent& Event : Events)
+	{
+		bool bEventSuccess = true;
+		Event.NetSerialize(Ar, Map, bEventSuccess);
+		bSuccess &= bEventSuccess;
+
+		if (Ar.IsError())
+		{
+			return false;
+		}
+	}
+
+	return bSuccess;
+}
+
+// ===== COMPRESSED PAYLOADS =====
+
+bool FReplicationCompressedString::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	TArray<uint8> Utf8Bytes;
+	int64 NumBits = 0;
+
+	if (Ar.IsSaving())
+	{
+		const FTCHARToUTF8 Utf8(*Value);
+		Utf8Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		NumBits = static_cast<int64>(Utf8Bytes.Num()) * 8;
+	}
+
+	FNetworkReplicationCompressor::SerializePayload(Ar, Map, EReplicationPayloadCategory::CustomEvent, Utf8Bytes, NumBits);
+
+	if (Ar.IsLoading() && !Ar.IsError())
+	{
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Utf8Bytes.GetData()), Utf8Bytes.Num());
+		Value = FString(Converted.Length(), Converted.Get());
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
@@ -0,0 +1,116 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationActorPool.h
+// Declares UNetworkReplicationActorPool, a per-world pool of actors spawned through UNetworkReplicationComponent.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/Interface.h"
+#include "UObject/ObjectKey.h"
+#include "Engine/TimerHandle.h"
+#include "NetworkReplicationActorPool.generated.h"
+
+class UNetworkReplicationComponent;
+
+UINTERFACE(MinimalAPI, Blueprintable)
+class UNetworkReplicationPooledActor : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Optional reset hook for pooled actors. A pooled actor runs BeginPlay only when first spawned, so per-use state
+ * such as projectile velocity or remaining damage has to be restored here instead
+ */
+class NETWORKREPLICATIONSUBSYSTEM_API INetworkReplicationPooledActor
+{
+	GENERATED_BODY()
+
+public:
+	/** Called once the actor has left the pool and been placed, shown and had collision and tick restored */
+	UFUNCTION(BlueprintNativeEvent, Category = "Network Replication|Actor Pool")
+	void OnAcquiredFromPool();
+
+	/** Called once the actor has been detached, hidden and had collision and tick disabled on its way back to the pool */
+	UFUNCTION(BlueprintNativeEvent, Category = "Network Replication|Actor Pool")
+	void OnReturnedToPool();
+};
+
+/** Idle actors pooled for one class */
+USTRUCT()
+struct FNetworkReplicationActorPoolEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> Idle;
+};
+
+/**
+ * Per-world pool behind UNetworkReplicationComponent::bPoolSpawnedActors
+ * Actors go back to the pool through ReleaseActor, or when their class's InitialLifeSpan runs out; the pool takes the
+ * life span over from the engine so they are released instead of destroyed. Replicated classes are never pooled,
+ * because hiding the server's copy would replicate to clients
+ */
+UCLASS()
+class NETWORKREPLICATIONSUBSYSTEM_API UNetworkReplicationActorPool : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** Idle actor of ActorClass moved to Location, or a newly spawned one. Spawner is told when the actor is released */
+	AActor* Acquire(TSubclassOf<AActor> ActorClass, const FVector& Location, const FRotator& Rotation, UNetworkReplicationComponent* Spawner);
+
+	/** Returns a pooled actor to its pool, or destroys it when the pool is full or the actor was not pooled */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Actor Pool")
+	void ReleaseActor(AActor* Actor);
+
+	/** Spawns idle actors until ActorClass has Count of them, within ActorPoolMaxPerClass */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Actor Pool")
+	void Prewarm(TSubclassOf<AActor> ActorClass, int32 Count);
+
+	/** Destroys every idle actor. Actors in use stay pooled and return as usual */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Actor Pool")
+	void EmptyPool();
+
+	/** Actors in use and idle, plus acquisitions served from idle, spawned, and releases destroyed because the pool was full */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Monitoring")
+	void GetPoolStats(int32& OutLive, int32& OutIdle, int64& OutHits, int64& OutMisses, int64& OutDiscarded) const;
+
+	static bool CanPoolClass(const UClass* ActorClass);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	AActor* SpawnPooledActor(UClass* ActorClass, const FVector& Location, const FRotator& Rotation);
+	void ActivateActor(AActor* Actor, UNetworkReplicationComponent* Spawner);
+	void DeactivateActor(AActor* Actor);
+	void OnLifeSpanExpired(TWeakObjectPtr<AActor> Actor);
+	int32 GetMaxPerClass() const;
+
+	UFUNCTION()
+	void OnPooledActorDestroyed(AActor* Actor);
+
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FNetworkReplicationActorPoolEntry> Pools;
+
+	/** Pooled actors currently in use */
+	struct FLiveActor
+	{
+		TWeakObjectPtr<UNetworkReplicationComponent> Spawner;
+		FTimerHandle LifeSpanTimer;
+	};
+
+	TMap<TObjectKey<AActor>, FLiveActor> LiveActors;
+
+	int32 NumIdle = 0;
+	int64 Hits = 0;
+	int64 Misses = 0;
+	int64 Discarded = 0;
+};
@@ -14,6 +14,7 @@
 #include "NiagaraComponent.h"
 #include "GameFramework/Actor.h"
 #include "NetworkReplicationTypes.h"
+#include "NetworkReplicationComponentRegistry.h"
 #include "NetworkReplicationComponent.generated.h"
 
 /**
@@ -22,6 +23,7 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAnimationReplicated, UAnimMontage*, Montage);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSoundReplicated, USoundBase*, Sound);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnActorSpawnedReplicated, AActor*, SpawnedActor);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnActorBatchSpawned, FReplicationSpawnBatchHandle, Handle, const TArray<AActor*>&, SpawnedActors);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNiagaraEffectReplicated, UNiagaraSystem*, Effect);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnComponentDestroyed, class UNetworkReplicationComponent*, Component);
 
@@ -30,6 +32,22 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnComponentDestroyed, class UNetwor
  */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnVariableReplicated, FName, VariableName, FString, VariableValue);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCustomEventReplicated, FName, EventName, FString, EventData);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStructEventReplicated, FName, EventName, const FInstancedStruct&, Payload);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnStructEventReplicatedNative, FName /*EventName*/, const FInstancedStruct& /*Payload*/);
+
+/**
+ * Typed variable delegates, broadcast without converting the value to text
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnFloatVariableReplicated, FName, VariableName, float, Value);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnIntVariableReplicated, FName, VariableName, int32, Value);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBoolVariableReplicated, FName, VariableName, bool, Value);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnVectorVariableReplicated, FName, VariableName, FVector, Value);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnVariableValueReplicatedNative, FName /*VariableName*/, const FReplicatedVariableValue& /*Value*/);
+
+/**
+ * Latest-wins state delegate
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStateReplicated, FName, Key, const FReplicatedVariableValue&, Value);
 
 /**
  * Motion matching replication delegates for pose search and trajectory data
@@ -69,6 +87,10 @@ class NETWORKREPLICATIONSUBSYSTEM_API UNetworkReplicationComponent : public UAct
 {
 	GENERATED_BODY()
 
+	friend struct FReplicatedVariableItem;
+	friend class UNetworkReplicationSubsystem;
+	friend class UNetworkReplicationRelayComponent;
+
 public:
 	UNetworkReplicationComponent();
 
@@ -76,7 +98,8 @@ protected:
 	virtual void BeginPlay() override;
 
 public:
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	/** Periodic flushes and resends. Called by the subsystem's central tick once per ReplicationInterval */
+	void TickReplication();
 
 	// Network Replication Functions - Focused on actual replication, not duplicating UE systems
 	UFUNCTION(BlueprintCallable, Category = "Network Replication|Animation", CallInEditor)
@@ -97,6 +120,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Network Replication|Actor", CallInEditor)
 	AActor* ReplicateActorSpawnAttached(TSubclassOf<AActor> ActorClass, FName AttachSocketName = NAME_None, FVector LocationOffset = FVector::ZeroVector, FRotator RotationOffset = FRotator::ZeroRotator);
 
+	/** Server: spawns each request once as a replicated actor owned by this component's owner, spread over ticks. OnActorBatchSpawned fires with the returned handle when all exist. Invalid handle on clients */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Actor")
+	FReplicationSpawnBatchHandle ReplicateActorSpawnBatch(const TArray<FReplicationSpawnRequest>& Requests);
+
 	UFUNCTION(BlueprintCallable, Category = "Network Replication|Niagara", CallInEditor)
 	UNiagaraComponent* ReplicateNiagaraEffect(UNiagaraSystem* Effect, FVector Location = FVector::ZeroVector, FRotator Rotation = FRotator::ZeroRotator, bool bAttachToOwner = false, FName AttachSocketName = NAME_None);
 
@@ -116,10 +143,64 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Network Replication|Variables", CallInEditor)
 	void ReplicateVectorVariable(FName VariableName, FVector Value);
 
+	/** Replicates an already typed value; the Replicate*Variable functions forward here */
+	void ReplicateVariableValue(FName VariableName, const FReplicatedVariableValue& Value);
+
+	// ===== PERSISTENT VARIABLE ACCESS =====
+	UFUNCTION(BlueprintPure, Category = "Network Replication|Variables")
+	bool GetReplicatedVariable(FName VariableName, FReplicatedVariableValue& OutValue) const;
+
+	UFUNCTION(BlueprintPure, Category = "Network Replication|Variables")
+	FString GetStringVariable(FName VariableName, const FString& DefaultValue = TEXT("")) const;
+
+	UFUNCTION(BlueprintPure, Category = "Network Replication|Variables")
+	float GetFloatVariable(FName VariableName, float DefaultValue = 0.0f) const;
+
+	UFUNCTION(BlueprintPure, Category = "Network Replication|Variables")
+	int32 GetIntVariable(FName VariableName, int32 DefaultValue = 0) const;
+
+	UFUNCTION(BlueprintPure, Category = "Network Replication|Variables")
+	bool GetBoolVariable(FName VariableName, bool DefaultValue = false) const;
+
+	UFUNCTION(BlueprintPure, Category = "Network Replication|Variables")
+	FVector GetVectorVariable(FName VariableName, FVector DefaultValue = FVector::ZeroVector) const;
+
+	// ===== LATEST-WINS STATE =====
+	/** Sends unreliably; only the newest value per key is resent until acknowledged */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|State")
+	void ReplicateFloatState(FName Key, float Value);
+
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|State")
+	void ReplicateIntState(FName Key, int32 Value);
+
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|State")
+	void ReplicateBoolState(FName Key, bool Value);
+
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|State")
+	void ReplicateVectorState(FName Key, FVector Value);
+
+	/** Replicates an already typed state value; the Replicate*State functions forward here */
+	void ReplicateStateValue(FName Key, const FReplicatedVariableValue& Value);
+
+	/** Newest known value for a key; on the owning client this is the local value, even before the server acknowledges it */
+	UFUNCTION(BlueprintPure, Category = "Network Replication|State")
+	bool GetReplicatedState(FName Key, FReplicatedVariableValue& OutValue) const;
+
 	// ===== CUSTOM EVENT REPLICATION =====
 	UFUNCTION(BlueprintCallable, Category = "Network Replication|Events", CallInEditor)
 	void ReplicateCustomEvent(FName EventName, const FString& EventData = TEXT(""));
 
+	/** Replicates a struct payload in binary, using the struct's NetSerialize when it has one */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Events")
+	void ReplicateStructEvent(FName EventName, const FInstancedStruct& Payload);
+
+	/** Replicates any USTRUCT value without wrapping it first */
+	template<typename T>
+	void ReplicateStructEvent(FName EventName, const T& Payload)
+	{
+		ReplicateStructEvent(EventName, FInstancedStruct::Make(Payload));
+	}
+
 	// ===== MOTION MATCHING REPLICATION =====
 	UFUNCTION(BlueprintCallable, Category = "Network Replication|Motion Matching", CallInEditor)
 	void ReplicateMotionMatchingDatabase(UObject* Database);
@@ -131,6 +212,30 @@ public:
 	void ReplicateTrajectoryData(const FVector& Position, const FRotator& Rotation);
 
 
+	// ===== EVENT BATCHING =====
+	/** Sends every queued event as one multicast, unreliable cosmetic events in a separate one ordered only among themselves. Called automatically by the send scheduler and the subsystem's central tick */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Batching")
+	void FlushEventBatch();
+
+	// ===== SEND SCHEDULING =====
+	/** Server: sends queued events in order until MaxBytes or the send budget runs out. Called by the subsystem scheduler; returns bytes sent */
+	int32 SendQueuedEvents(int32 MaxBytes);
+
+	bool HasQueuedEvents() const { return OutboundEvents.Num() > 0; }
+
+	// ===== NET DORMANCY =====
+	/** Server: resets the idle timer and wakes the owner if automatic dormancy put it to sleep. Replicate* calls do this already; call it after changing the owner's own replicated properties */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Dormancy")
+	void MarkReplicationActivity();
+
+	/** True while automatic dormancy holds the owner dormant */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Dormancy")
+	bool IsOwnerAutoDormant() const { return bOwnerAutoDormant; }
+
+	// ===== ACTOR POOLING =====
+	/** Called by UNetworkReplicationActorPool when an actor this component spawned is released or destroyed */
+	void OnPooledActorReleased(AActor* Actor);
+
 	// ===== DEBUGGING FUNCTIONS =====
 	UFUNCTION(BlueprintCallable, Category = "Network Replication|Debug", CallInEditor)
 	void EnableDebugLogging(bool bEnabled);
@@ -161,6 +266,14 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Network Replication|Events")
 	FOnActorSpawnedReplicated OnActorSpawned;
 
+	/** Server: a batch from ReplicateActorSpawnBatch has finished spawning. Failed spawns are left as null */
+	UPROPERTY(BlueprintAssignable, Category = "Network Replication|Events")
+	FOnActorBatchSpawned OnActorBatchSpawned;
+
+	/** Server: a batch was stopped by CancelSpawnBatch, with the actors spawned before it stopped */
+	UPROPERTY(BlueprintAssignable, Category = "Network Replication|Events")
+	FOnActorBatchSpawned OnActorBatchCancelled;
+
 	UPROPERTY(BlueprintAssignable, Category = "Network Replication|Events")
 	FOnNiagaraEffectReplicated OnNiagaraEffectReplicated;
 
@@ -174,6 +287,32 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Network Replication|Events")
 	FOnCustomEventReplicated OnCustomEventReplicated;
 
+	UPROPERTY(BlueprintAssignable, Category = "Network Replication|Events")
+	FOnStructEventReplicated OnStructEventReplicated;
+
+	/** Native listeners receive struct payloads without going through the Blueprint VM */
+	FOnStructEventReplicatedNative OnStructEventReplicatedNative;
+
+	// ===== TYPED VARIABLE EVENTS =====
+	UPROPERTY(BlueprintAssignable, Category = "Network Replication|Events")
+	FOnFloatVariableReplicated OnFloatVariableReplicated;
+
+	UPROPERTY(BlueprintAssignable, Category = "Network Replication|Events")
+	FOnIntVariableReplicated OnIntVariableReplicated;
+
+	UPROPERTY(BlueprintAssignable, Category = "Network Replication|Events")
+	FOnBoolVariableReplicated OnBoolVariableReplicated;
+
+	UPROPERTY(BlueprintAssignable, Category = "Network Replication|Events")
+	FOnVectorVariableReplicated OnVectorVariableReplicated;
+
+	/** Native listeners receive every variable with its typed payload */
+	FOnVariableValueReplicatedNative OnVariableValueReplicatedNative;
+
+	// ===== STATE EVENTS =====
+	UPROPERTY(BlueprintAssignable, Category = "Network Replication|Events")
+	FOnStateReplicated OnStateReplicated;
+
 	// ===== MOTION MATCHING EVENTS =====
 	UPROPERTY(BlueprintAssignable, Category = "Network Replication|Motion Matching|Events")
 	FOnMotionMatchingReplicated OnMotionMatchingReplicated;
@@ -201,12 +340,66 @@ public:
 	UPROPERTY(BlueprintReadWrite, Category = "Network Replication|Debug")
 	bool bDebugMode = false;
 
+	// ===== VARIABLE SETTINGS =====
+	/** Keep variables in a replicated store so late joiners receive current values. When false, variables are fire-and-forget multicasts */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Variables")
+	bool bPersistentVariables = true;
+
+	/** Change detection applied to variables without an entry in VariableThresholds */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Variables")
+	FReplicatedVariableThreshold DefaultVariableThreshold;
+
+	/** Per-variable change detection overrides */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Variables")
+	TMap<FName, FReplicatedVariableThreshold> VariableThresholds;
+
+	// ===== QUANTIZATION SETTINGS =====
+	/** Packing rules for float and vector variables, trajectory data and sound locations. Receivers must use the same asset */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Quantization")
+	TObjectPtr<class UNetworkReplicationQuantizationProfile> QuantizationProfile;
+
+	// ===== STATE SETTINGS =====
+	/** Seconds an owning client waits for an acknowledgement before resending the newest value of a key */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|State", meta = (ClampMin = "0.0"))
+	float StateResendInterval = 0.1f;
+
+	// ===== PRIORITY SETTINGS =====
+	/** Scheduling weight for queued events, used when ReplicationPriorityClass is not listed in the subsystem's PriorityClasses */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Priority", meta = (ClampMin = "0.01"))
+	float ReplicationPriority = 1.0f;
+
+	/** Shared scheduling weight looked up in the subsystem's PriorityClasses, so similar components can be tuned together */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Priority")
+	FName ReplicationPriorityClass;
+
+	/** Send sounds and Niagara effects reliably. Off sends them unreliably, so under load they are dropped instead of filling the reliable buffer */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Priority")
+	bool bReliableCosmeticEvents = false;
+
+	// ===== POOLING SETTINGS =====
+	/** Take actors spawned by ReplicateActorSpawn and ReplicateActorSpawnAttached from UNetworkReplicationActorPool, on every machine. Release them with ReleaseActor */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Pooling")
+	bool bPoolSpawnedActors = false;
+
+	// ===== BATCHING SETTINGS =====
+	/** Queue sound, Niagara, custom event and transient variable multicasts and send them together as one packed RPC */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Batching")
+	bool bBatchEvents = false;
+
 	UPROPERTY(BlueprintReadOnly, Category = "Network Replication|Debug")
 	int32 TotalReplications = 0;
 
 	UPROPERTY(BlueprintReadOnly, Category = "Network Replication|Debug")
 	float LastReplicationTime = 0.0f;
 
+	/** Variable sends skipped because the value was unchanged or inside its resend interval */
+	UPROPERTY(BlueprintReadOnly, Category = "Network Replication|Debug")
+	int32 SuppressedReplications = 0;
+
+	/** State values resent by the owning client because no acknowledgement arrived in time */
+	UPROPERTY(BlueprintReadOnly, Category = "Network Replication|Debug")
+	int32 StateResends = 0;
+
 	// ===== REPLICATED PROPERTIES FOR HOT JOINING =====
 	UPROPERTY(ReplicatedUsing = OnRep_AttachmentInfo, BlueprintReadOnly, Category = "Network Replication|Hot Joining")
 	FAttachmentInfo AttachmentInfo;
@@ -217,6 +410,14 @@ public:
 	UPROPERTY(ReplicatedUsing = OnRep_AnimationPrediction, BlueprintReadOnly, Category = "Network Replication|Prediction")
 	FAnimationPredictionData AnimationPrediction;
 
+	/** Persistent keyed variables, delta replicated per entry */
+	UPROPERTY(Replicated)
+	FReplicatedVariableArray ReplicatedVariables;
+
+	/** Latest-wins state. Property replication is unreliable and resends only the current value of an entry a connection lost */
+	UPROPERTY(Replicated)
+	FReplicatedVariableArray ReplicatedState;
+
 protected:
 	// Server RPCs
 	UFUNCTION(Server, Reliable, Category = "Network Replication|RPC")
@@ -229,7 +430,7 @@ protected:
 	void ServerPlaySound(USoundBase* Sound, float VolumeMultiplier, float PitchMultiplier, float StartTime);
 
 	UFUNCTION(Server, Reliable, Category = "Network Replication|RPC")
-	void ServerPlaySoundAtLocation(USoundBase* Sound, FVector Location, float VolumeMultiplier, float PitchMultiplier, float StartTime);
+	void ServerPlaySoundAtLocation(USoundBase* Sound, const FQuantizedValue& Location, float VolumeMultiplier, float PitchMultiplier, float StartTime);
 
 	UFUNCTION(Server, Reliable, Category = "Network Replication|RPC")
 	void ServerSpawnActor(TSubclassOf<AActor> ActorClass, FVector Location, FRotator Rotation, bool bAttachToOwner);
@@ -251,7 +452,7 @@ protected:
 	void MulticastPlaySound(USoundBase* Sound, float VolumeMultiplier, float PitchMultiplier, float StartTime);
 
 	UFUNCTION(NetMulticast, Reliable, Category = "Network Replication|RPC")
-	void MulticastPlaySoundAtLocation(USoundBase* Sound, FVector Location, float VolumeMultiplier, float PitchMultiplier, float StartTime);
+	void MulticastPlaySoundAtLocation(USoundBase* Sound, const FQuantizedValue& Location, float VolumeMultiplier, float PitchMultiplier, float StartTime);
 
 	UFUNCTION(NetMulticast, Reliable, Category = "Network Replication|RPC")
 	void MulticastSpawnActor(TSubclassOf<AActor> ActorClass, FVector Location, FRotator Rotation, bool bAttachToOwner);
@@ -262,18 +463,49 @@ protected:
 	UFUNCTION(NetMulticast, Reliable, Category = "Network Replication|RPC")
 	void MulticastSpawnNiagaraEffect(UNiagaraSystem* Effect, FVector Location, FRotator Rotation, bool bAttachToOwner, FName AttachSocketName);
 
+	// ===== COSMETIC RPCs =====
+	// Unreliable twins of the sound and Niagara RPCs, used unless bReliableCosmeticEvents is set
+	UFUNCTION(NetMulticast, Unreliable, Category = "Network Replication|RPC")
+	void MulticastPlaySoundUnreliable(USoundBase* Sound, float VolumeMultiplier, float PitchMultiplier, float StartTime);
+
+	UFUNCTION(NetMulticast, Unreliable, Category = "Network Replication|RPC")
+	void MulticastPlaySoundAtLocationUnreliable(USoundBase* Sound, const FQuantizedValue& Location, float VolumeMultiplier, float PitchMultiplier, float StartTime);
+
+	UFUNCTION(NetMulticast, Unreliable, Category = "Network Replication|RPC")
+	void MulticastSpawnNiagaraEffectUnreliable(UNiagaraSystem* Effect, FVector Location, FRotator Rotation, bool bAttachToOwner, FName AttachSocketName);
+
 	// ===== NEW RPCs =====
 	UFUNCTION(Server, Reliable, Category = "Network Replication|RPC")
-	void ServerReplicateVariable(FName VariableName, const FString& Value, int32 VariableType);
+	void ServerReplicateVariable(const FReplicatedNameId& VariableName, const FReplicatedVariableValue& Value);
+
+	UFUNCTION(Server, Reliable, Category = "Network Replication|RPC")
+	void ServerReplicateCustomEvent(const FReplicatedNameId& EventName, const FReplicationCompressedString& EventData);
 
 	UFUNCTION(Server, Reliable, Category = "Network Replication|RPC")
-	void ServerReplicateCustomEvent(FName EventName, const FString& EventData);
+	void ServerReplicateStructEvent(const FReplicatedNameId& EventName, const FInstancedStruct& Payload);
 
 	UFUNCTION(NetMulticast, Reliable, Category = "Network Replication|RPC")
-	void MulticastReplicateVariable(FName VariableName, const FString& Value, int32 VariableType);
+	void MulticastReplicateVariable(const FReplicatedNameId& VariableName, const FReplicatedVariableValue& Value);
 
 	UFUNCTION(NetMulticast, Reliable, Category = "Network Replication|RPC")
-	void MulticastReplicateCustomEvent(FName EventName, const FString& EventData);
+	void MulticastReplicateCustomEvent(const FReplicatedNameId& EventName, const FReplicationCompressedString& EventData);
+
+	UFUNCTION(NetMulticast, Reliable, Category = "Network Replication|RPC")
+	void MulticastReplicateStructEvent(const FReplicatedNameId& EventName, const FInstancedStruct& Payload);
+
+	// ===== STATE RPCs =====
+	UFUNCTION(Server, Unreliable, Category = "Network Replication|RPC")
+	void ServerUpdateState(const FReplicatedNameId& Key, const FReplicatedVariableValue& Value, uint16 Sequence);
+
+	UFUNCTION(Client, Unreliable, Category = "Network Replication|RPC")
+	void ClientAckState(const FReplicatedNameId& Key, uint16 Sequence);
+
+	// ===== BATCHING RPCs =====
+	UFUNCTION(NetMulticast, Reliable, Category = "Network Replication|RPC")
+	void MulticastReplicateEventBatch(const FReplicationEventBatch& Batch);
+
+	UFUNCTION(NetMulticast, Unreliable, Category = "Network Replication|RPC")
+	void MulticastReplicateCosmeticEventBatch(const FReplicationEventBatch& Batch);
 
 	// ===== MOTION MATCHING RPCs =====
 	UFUNCTION(Server, Reliable, Category = "Network Replication|Motion Matching|RPC")
@@ -283,7 +515,7 @@ protected:
 	void ServerReplicatePoseSearchSchema(UObject* Schema);
 
 	UFUNCTION(Server, Reliable, Category = "Network Replication|Motion Matching|RPC")
-	void ServerReplicateTrajectoryData(FVector Position, FRotator Rotation);
+	void ServerReplicateTrajectoryData(const FQuantizedValue& Position, const FQuantizedValue& Rotation);
 
 	UFUNCTION(NetMulticast, Reliable, Category = "Network Replication|Motion Matching|RPC")
 	void MulticastReplicateMotionMatchingDatabase(UObject* Database);
@@ -292,7 +524,7 @@ protected:
 	void MulticastReplicatePoseSearchSchema(UObject* Schema);
 
 	UFUNCTION(NetMulticast, Reliable, Category = "Network Replication|Motion Matching|RPC")
-	void MulticastReplicateTrajectoryData(FVector Position, FRotator Rotation);
+	void MulticastReplicateTrajectoryData(const FQuantizedValue& Position, const FQuantizedValue& Rotation);
 
 
 	// Override EndPlay to handle cleanup
@@ -311,8 +543,164 @@ protected:
 	UFUNCTION()
 	void OnRep_AnimationPrediction();
 
+	// Server-side dispatch, queued for the subsystem scheduler then multicast or added to the pending batch
+	void DispatchSound(USoundBase* Sound, float VolumeMultiplier, float PitchMultiplier, float StartTime);
+	void DispatchSoundAtLocation(USoundBase* Sound, const FQuantizedValue& Location, float VolumeMultiplier, float PitchMultiplier, float StartTime);
+	void DispatchNiagaraEffect(UNiagaraSystem* Effect, const FVector& Location, const FRotator& Rotation, bool bAttachToOwner, FName AttachSocketName);
+	void DispatchVariable(FName VariableName, const FReplicatedVariableValue& Value);
+	void DispatchCustomEvent(FName EventName, const FString& EventData);
+	void DispatchStructEvent(FName EventName, const FInstancedStruct& Payload);
+
+	/** Spawns ActorClass, through the actor pool when bPoolSpawnedActors is set */
+	AActor* SpawnReplicatedActor(TSubclassOf<AActor> ActorClass, const FVector& Location, const FRotator& Rotation);
+
+	// Send budget helpers
+	void SubmitEvent(FReplicationBatchedEvent&& Event);
+	/** Fans Event out or multicasts it, charging its recipients. Returns false, leaving Event untouched, when the budget holds it back */
+	bool SendEvent(FReplicationBatchedEvent&& Event, EReplicationSendPriority BudgetPriority);
+	void ChargeSendBudget(int32 Bytes);
+	bool IsUnreliableCosmetic(const FReplicationBatchedEvent& Event) const;
+	bool HasPendingEventBatch() const { return PendingEventBatch.Events.Num() > 0 || PendingCosmeticBatch.Events.Num() > 0; }
+
+	/** Dedicated servers have nobody to see or hear cosmetics, so sound and Niagara handlers return straight away */
+	bool ShouldSkipCosmeticPlayback() const { return GetNetMode() == NM_DedicatedServer; }
+
+	// Event fan-out helpers
+	bool TryFanOutEvent(const FReplicationBatchedEvent& Event, EReplicationSendPriority BudgetPriority);
+	static float GetEventAudibleRadius(const FReplicationBatchedEvent& Event);
+
+	// Automatic dormancy helpers
+	void UpdateAutoDormancy();
+	bool IsIdleForDormancy(double Now, float IdleSeconds) const;
+	void SetOwnerAutoDormant(bool bDormant);
+
+	// Session name dictionary helpers
+	FReplicatedNameId MakeNetName(FName Name) const;
+	bool ResolveNetName(const FReplicatedNameId& NetName, FName& OutName) const;
+
+	/** Like ResolveNetName, but also fails while earlier events are parked, so a handler parks behind them */
+	bool ResolveNetNameInOrder(const FReplicatedNameId& NetName, FName& OutName) const;
+
+	/** Holds a received event until NetName's dictionary entry arrives, behind any event already held */
+	void ParkUntilNameResolved(const FReplicatedNameId& NetName, TFunction<void()>&& Dispatch);
+
+	/** Replays parked events in receive order, up to the first whose name is still unknown. Called by the subsystem */
+	void DispatchParkedNameEvents();
+	void ExpireParkedNameEvents();
+
+	// Quantization helpers, pass values through unchanged when no profile rule applies
+	bool QuantizeVariable(FName VariableName, FReplicatedVariableValue& InOutValue) const;
+	/** Returns false if the value can not be decoded with this machine's profile */
+	bool DequantizeVariable(FName VariableName, FReplicatedVariableValue& InOutValue) const;
+	FQuantizedValue QuantizeField(EReplicationQuantizedField Field, const FVector& Value, int32 NumComponents = 3) const;
+	/** Returns false if the value can not be decoded with this machine's profile */
+	bool DequantizeField(EReplicationQuantizedField Field, const FQuantizedValue& Value, FVector& OutValue) const;
+
+	// Latest-wins state helpers
+	void HandleStoreItemReplicated(const FReplicatedVariableArray& Store, FName Key, FReplicatedVariableValue& Value, uint16 SourceSequence);
+	void ResendUnackedStates();
+
+	// Server RPC rate limiting helpers
+	bool PassesRateLimit(EReplicationRPCFamily Family, bool bCoalesced = false);
+	void ApplyClientVariable(FName VariableName, const FReplicatedVariableValue& Value);
+	/** Decodes a client's packed value and applies it; values this machine can not decode are dropped */
+	void ApplyPackedClientVariable(FName VariableName, const FReplicatedVariableValue& Value);
+	void FlushCoalescedRPCs();
+
+	// Change detection helpers
+	void SendVariableValue(FName VariableName, const FReplicatedVariableValue& Value);
+	void FlushPendingVariables();
+
 	// Helper functions
+	class UNetworkReplicationSubsystem* GetReplicationSubsystem() const;
+	/** Counts one replication and, while registered, feeds the subsystem's running aggregates */
+	void RecordReplication(EReplicationRPCFamily Family);
+	void StoreVariableValue(FName VariableName, const FReplicatedVariableValue& Value);
+	void BroadcastVariableValue(FName VariableName, const FReplicatedVariableValue& Value);
 	class UAnimInstance* GetAnimInstance() const;
 	class USkeletalMeshComponent* GetSkeletalMeshComponent() const;
 	class UAudioComponent* GetAudioComponent() const;
+
+private:
+	/** Events queued this frame while bBatchEvents is enabled */
+	UPROPERTY(Transient)
+	FReplicationEventBatch PendingEventBatch;
+
+	/** Sounds and Niagara effects queued this frame while bBatchEvents is enabled, sent unreliably */
+	UPROPERTY(Transient)
+	FReplicationEventBatch PendingCosmeticBatch;
+
+	/** Server: sound, Niagara, custom, struct and transient variable events waiting for the scheduler, in send order */
+	UPROPERTY(Transient)
+	TArray<FReplicationBatchedEvent> OutboundEvents;
+
+	static constexpr int32 MaxOutboundEvents = 256;
+
+	/** Server: world time of the last send or property change, and whether automatic dormancy made the owner dormant */
+	double LastReplicationActivityTime = 0.0;
+	bool bOwnerAutoDormant = false;
+
+	/** Received events waiting for a dictionary entry, in receive order; later events queue behind them */
+	struct FParkedNameEvent
+	{
+		FReplicatedNameId Name;
+		double ParkedTime = 0.0;
+		TFunction<void()> Dispatch;
+	};
+
+	TArray<FParkedNameEvent> ParkedNameEvents;
+	bool bDispatchingParkedNameEvents = false;
+
+	/** Slot in the subsystem's component registry, set while registered */
+	FNetworkReplicationComponentHandle RegistryHandle;
+
+	/** Last sent value per variable, plus a newer value held back by the resend interval */
+	struct FVariableSendState
+	{
+		FReplicatedVariableValue LastSentValue;
+		FReplicatedVariableValue PendingValue;
+		double LastSendTime = 0.0;
+		bool bHasPendingValue = false;
+	};
+
+	TMap<FName, FVariableSendState> VariableSendStates;
+	int32 NumPendingVariables = 0;
+
+	/** Newest state value per key on the owning client, kept until the server acknowledges its sequence */
+	struct FStateSendState
+	{
+		FReplicatedVariableValue Value;
+		double LastSendTime = 0.0;
+		uint16 Sequence = 0;
+		bool bAcked = true;
+		/** The server has written the key since this client's last write, so the replicated store holds the current value */
+		bool bServerOverridden = false;
+	};
+
+	TMap<FName, FStateSendState> OutgoingStates;
+	int32 NumUnackedStates = 0;
+
+	/** Newest sequence applied per key on the server, so reordered packets cannot roll state back */
+	TMap<FName, uint16> ReceivedStateSequences;
+
+	void SendStateValue(FName Key, FStateSendState& State);
+
+	/** Server: logs a client's unknown name id once per connection, and at Verbose after that */
+	void WarnUnknownClientName(const TCHAR* RPCName, const FReplicatedNameId& NetName) const;
+
+	/** Server: newest packed client value per name held back by the rate limiter, oldest arrival first, applied as tokens become available */
+	TArray<TPair<FName, FReplicatedVariableValue>> CoalescedVariables;
+	FQuantizedValue CoalescedTrajectoryPosition;
+	FQuantizedValue CoalescedTrajectoryRotation;
+	bool bHasCoalescedTrajectory = false;
+
+	/** Variables and event fields already warned about as undecodable, for the profile the warnings were about */
+	mutable TSet<FName> UndecodableVariables;
+	mutable uint32 UndecodableFields = 0;
+	mutable TWeakObjectPtr<const UNetworkReplicationQuantizationProfile> UndecodableWarningsProfile;
+
+	/** True the first time a variable or field can not be decoded under the current profile */
+	bool ShouldWarnUndecodableVariable(FName VariableName) const;
+	bool ShouldWarnUndecodableField(EReplicationQuantizedField Field) const;
+	void ResetUndecodableWarningsOnProfileChange() const;
 };
\ No newline at end of file
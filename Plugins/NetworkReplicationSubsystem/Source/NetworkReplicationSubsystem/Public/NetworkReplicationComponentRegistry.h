@@ -0,0 +1,68 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationComponentRegistry.h
+// Declares the slot registry that tracks the subsystem's registered replication components.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UNetworkReplicationComponent;
+
+/** Refers to a registry slot; stale once the component is removed, even if the slot is reused */
+struct FNetworkReplicationComponentHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsSet() const { return Index != INDEX_NONE; }
+	void Reset() { Index = INDEX_NONE; Generation = 0; }
+};
+
+/**
+ * Sparse slots with generation counters over a dense array of live components
+ * Add and Remove are O(1): freed slots are reused, and the dense array is kept contiguous by swapping the last component
+ * into the gap, so iteration order changes on removal. Components must be removed before they are destroyed; the
+ * registry holds raw pointers and is not visible to the garbage collector
+ */
+class NETWORKREPLICATIONSUBSYSTEM_API FNetworkReplicationComponentRegistry
+{
+public:
+	FNetworkReplicationComponentHandle Add(UNetworkReplicationComponent* Component);
+
+	/** Returns false for a stale or unset handle */
+	bool Remove(const FNetworkReplicationComponentHandle& Handle);
+
+	bool IsValidHandle(const FNetworkReplicationComponentHandle& Handle) const
+	{
+		return Slots.IsValidIndex(Handle.Index) && Slots[Handle.Index].Generation == Handle.Generation && Slots[Handle.Index].DenseIndex != INDEX_NONE;
+	}
+
+	UNetworkReplicationComponent* Get(const FNetworkReplicationComponentHandle& Handle) const
+	{
+		return IsValidHandle(Handle) ? Components[Slots[Handle.Index].DenseIndex] : nullptr;
+	}
+
+	/** Live components, contiguous and in no particular order */
+	const TArray<UNetworkReplicationComponent*>& GetComponents() const { return Components; }
+
+	int32 Num() const { return Components.Num(); }
+	int32 NumSlots() const { return Slots.Num(); }
+	int32 NumFreeSlots() const { return FreeSlots.Num(); }
+
+	void Reset();
+
+private:
+	struct FSlot
+	{
+		uint32 Generation = 1;
+		int32 DenseIndex = INDEX_NONE;
+	};
+
+	TArray<FSlot> Slots;
+	TArray<int32> FreeSlots;
+	TArray<UNetworkReplicationComponent*> Components;
+
+	/** Slot owning each entry of Components, so a swap can repoint the moved component's slot */
+	TArray<int32> ComponentSlots;
+};
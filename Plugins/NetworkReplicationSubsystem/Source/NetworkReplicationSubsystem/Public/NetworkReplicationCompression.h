@@ -0,0 +1,139 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationCompression.h
+// Declares the payload compression envelope used for custom event strings and event batches.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "NetworkReplicationCompression.generated.h"
+
+class UPackageMap;
+class UNetworkReplicationCompressionDictionary;
+
+/**
+ * Codec applied to payloads above the compression threshold
+ */
+UENUM(BlueprintType)
+enum class EReplicationCompressionCodec : uint8
+{
+	/** Payloads are always sent uncompressed */
+	None,
+	Zlib,
+	Gzip,
+	LZ4,
+	Oodle,
+	/** Zlib primed with a shared dictionary asset, which suits small payloads best */
+	ZlibDictionary,
+	Count UMETA(Hidden)
+};
+
+/**
+ * Payload kinds tracked separately in compression stats
+ */
+UENUM(BlueprintType)
+enum class EReplicationPayloadCategory : uint8
+{
+	CustomEvent,
+	EventBatch,
+	Count UMETA(Hidden)
+};
+
+/**
+ * Compression results for one payload category
+ * Sizes and compress time are measured on the sender, decompress time on the receiver
+ */
+USTRUCT(BlueprintType)
+struct NETWORKREPLICATIONSUBSYSTEM_API FReplicationCompressionStats
+{
+	GENERATED_BODY()
+
+	/** Payloads written */
+	UPROPERTY(BlueprintReadOnly, Category = "Compression")
+	int64 Payloads = 0;
+
+	/** Payloads that were sent compressed */
+	UPROPERTY(BlueprintReadOnly, Category = "Compression")
+	int64 CompressedPayloads = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Compression")
+	int64 RawBytes = 0;
+
+	/** Bytes written after compression, excluding envelope headers */
+	UPROPERTY(BlueprintReadOnly, Category = "Compression")
+	int64 WireBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Compression")
+	double CompressSeconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Compression")
+	double DecompressSeconds = 0.0;
+
+	/** Wire size relative to raw size, lower is better */
+	double GetRatio() const { return RawBytes > 0 ? static_cast<double>(WireBytes) / static_cast<double>(RawBytes) : 1.0; }
+};
+
+/**
+ * Compresses payloads according to the subsystem's settings
+ * Receivers only need the same dictionary asset; codec and sizes are carried in each envelope
+ */
+class NETWORKREPLICATIONSUBSYSTEM_API FNetworkReplicationCompressor
+{
+public:
+	/** Upper bound accepted when reading, protects receivers from malformed sizes */
+	static constexpr int32 MaxPayloadBytes = 256 * 1024;
+
+	/** Samples kept while capturing, enough to train a dictionary without unbounded growth */
+	static constexpr int32 MaxCapturedSamples = 8192;
+
+	void Configure(bool bInEnabled, EReplicationCompressionCodec InCodec, int32 InThresholdBytes, const UNetworkReplicationCompressionDictionary* InDictionary);
+
+	/**
+	 * Writes or reads a payload through the compression envelope
+	 * Uses the compressor of the subsystem that owns Map's connection, so settings and stats stay per game instance
+	 */
+	static void SerializePayload(FArchive& Ar, UPackageMap* Map, EReplicationPayloadCategory Category, TArray<uint8>& Data, int64& NumBits);
+
+	const FReplicationCompressionStats& GetStats(EReplicationPayloadCategory Category) const { return Stats[static_cast<int32>(Category)]; }
+	void ResetStats();
+
+	/** Records raw payloads as they are sent, for offline dictionary training */
+	void StartCapture();
+	TArray<TArray<uint8>> StopCapture();
+	bool IsCapturing() const { return bCapturing; }
+
+private:
+	static FNetworkReplicationCompressor* FindForPackageMap(UPackageMap* Map);
+
+	void WritePayload(FArchive& Ar, EReplicationPayloadCategory Category, const TArray<uint8>& Data, int64 NumBits);
+	void ReadPayload(FArchive& Ar, EReplicationPayloadCategory Category, TArray<uint8>& Data, int64& NumBits);
+
+	bool Compress(const uint8* Source, int32 SourceSize, TArray<uint8>& OutCompressed) const;
+	bool Decompress(EReplicationCompressionCodec InCodec, const uint8* Source, int32 SourceSize, uint8* Dest, int32 DestSize) const;
+
+	bool bEnabled = false;
+	EReplicationCompressionCodec Codec = EReplicationCompressionCodec::None;
+	int32 ThresholdBytes = 256;
+	TWeakObjectPtr<const UNetworkReplicationCompressionDictionary> Dictionary;
+
+	FReplicationCompressionStats Stats[static_cast<int32>(EReplicationPayloadCategory::Count)];
+
+	bool bCapturing = false;
+	TArray<TArray<uint8>> CapturedSamples;
+
+	/**
+	 * Last payload written per category, reused when the same bytes are written again in the same frame
+	 * A multicast is serialized once per connection, and should be compressed, counted and sampled once
+	 */
+	struct FWrittenPayload
+	{
+		uint64 Frame = MAX_uint64;
+		int64 NumBits = 0;
+		TArray<uint8> Raw;
+		TArray<uint8> Compressed;
+		bool bCompressed = false;
+	};
+
+	FWrittenPayload LastWritten[static_cast<int32>(EReplicationPayloadCategory::Count)];
+};
@@ -0,0 +1,50 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationCompressionDictionary.h
+// Declares UNetworkReplicationCompressionDictionary, a shared compression dictionary trained from captured traffic.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Engine/EngineTypes.h"
+#include "NetworkReplicationCompressionDictionary.generated.h"
+
+/**
+ * Preset dictionary for the ZlibDictionary codec
+ * Capture samples with UNetworkReplicationSubsystem::StartCompressionCapture, then train in the editor and ship the asset to every machine
+ */
+UCLASS(BlueprintType)
+class NETWORKREPLICATIONSUBSYSTEM_API UNetworkReplicationCompressionDictionary : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Dictionary bytes, most valuable segments last since zlib favours recent history */
+	UPROPERTY(VisibleAnywhere, Category = "Dictionary")
+	TArray<uint8> DictionaryData;
+
+	/** CRC of DictionaryData, sent with each payload so a mismatched dictionary is detected instead of misread */
+	UPROPERTY(VisibleAnywhere, Category = "Dictionary")
+	uint32 DictionaryHash = 0;
+
+	/** Sample file written by StopCompressionCapture */
+	UPROPERTY(EditAnywhere, Category = "Training")
+	FFilePath SampleFile;
+
+	/** Zlib only looks back 32 KB, so larger dictionaries add nothing */
+	UPROPERTY(EditAnywhere, Category = "Training", meta = (ClampMin = "1024", ClampMax = "32768"))
+	int32 MaxDictionarySize = 32768;
+
+	/** Builds DictionaryData from the substrings shared by the most samples */
+	void TrainFromSamples(const TArray<TArray<uint8>>& Samples);
+
+	static bool SaveSamples(const FString& FilePath, const TArray<TArray<uint8>>& Samples);
+	static bool LoadSamples(const FString& FilePath, TArray<TArray<uint8>>& OutSamples);
+
+#if WITH_EDITOR
+	/** Trains from SampleFile and marks the asset dirty */
+	UFUNCTION(CallInEditor, Category = "Training")
+	void TrainFromSampleFile();
+#endif
+};
@@ -0,0 +1,85 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationGraph.h
+// Declares the replication graph node that applies subsystem relevancy settings, and a sample graph using it.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "BasicReplicationGraph.h"
+#include "UObject/ObjectKey.h"
+#include "NetworkReplicationGraph.generated.h"
+
+class UNetworkReplicationSubsystem;
+
+/**
+ * Routes actors owning a UNetworkReplicationComponent according to UNetworkReplicationSubsystem settings
+ * With relevancy enabled they go to the spatial grid, culled at MaxReplicationDistance; with it disabled, and for interest actors,
+ * they go to an always relevant list. Actors are re-routed whenever the subsystem's relevancy settings change
+ */
+UCLASS()
+class NETWORKREPLICATIONSUBSYSTEM_API UReplicationGraphNode_NetworkReplication : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	UReplicationGraphNode_NetworkReplication();
+
+	virtual void Initialize(const TSharedPtr<FReplicationGraphGlobalData>& InGraphGlobals) override;
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override;
+	virtual void NotifyResetAllNetworkActors() override;
+	virtual void PrepareForReplication() override;
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+	/** Grid that receives culled actors, normally shared with the rest of the graph. Without one every actor is always relevant */
+	void SetGridNode(UReplicationGraphNode_GridSpatialization2D* InGridNode) { GridNode = InGridNode; }
+
+	int32 GetNumGridActors() const;
+	int32 GetNumAlwaysRelevantActors() const { return ActorPlacements.Num() - GetNumGridActors(); }
+
+private:
+	UNetworkReplicationSubsystem* GetSubsystem() const;
+
+	/** Re-reads the subsystem settings and re-routes every actor if they changed since the last call */
+	void RefreshRouting();
+
+	void PlaceActor(AActor* Actor);
+	void UnplaceActor(AActor* Actor, bool bInGrid);
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_GridSpatialization2D> GridNode;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode;
+
+	/** Every routed actor, and whether it went to the grid */
+	TMap<TObjectKey<AActor>, bool> ActorPlacements;
+
+	int32 LastRelevancyRevision = INDEX_NONE;
+	bool bCachedRelevancyEnabled = true;
+	float CachedCullDistance = 0.0f;
+};
+
+/**
+ * Sample graph: UBasicReplicationGraph with actors owning a UNetworkReplicationComponent routed through UReplicationGraphNode_NetworkReplication
+ * Actors marked bAlwaysRelevant or bOnlyRelevantToOwner keep the basic graph's routing. Enable it with
+ * ReplicationDriverClassName="/Script/NetworkReplicationSubsystem.NetworkReplicationGraph" under your net driver's config section
+ */
+UCLASS(Transient, config = Engine)
+class NETWORKREPLICATIONSUBSYSTEM_API UNetworkReplicationGraph : public UBasicReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	virtual void InitGlobalGraphNodes() override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_NetworkReplication> NetworkReplicationNode;
+
+private:
+	static bool ShouldRouteToNetworkReplicationNode(const AActor* Actor);
+};
@@ -0,0 +1,46 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationIrisSerializers.h
+// Declares the Iris NetSerializers for the component's replicated hot joining and prediction state.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Iris/Serialization/NetSerializer.h"
+#include "NetworkReplicationIrisSerializers.generated.h"
+
+/**
+ * Iris serializer configs. The serializers are registered for FAttachmentInfo, FPredictionState and FAnimationPredictionData,
+ * so Iris replication fragments built for UNetworkReplicationComponent pick them up automatically
+ */
+USTRUCT()
+struct FAttachmentInfoNetSerializerConfig : public FNetSerializerConfig
+{
+	GENERATED_BODY()
+};
+
+USTRUCT()
+struct FPredictionStateNetSerializerConfig : public FNetSerializerConfig
+{
+	GENERATED_BODY()
+};
+
+USTRUCT()
+struct FAnimationPredictionDataNetSerializerConfig : public FNetSerializerConfig
+{
+	GENERATED_BODY()
+};
+
+namespace UE::Net
+{
+
+/** Relative location to 0.01 cm, rotation to 16 bits per axis, scale only when not unit; references and socket forwarded to the engine serializers */
+UE_NET_DECLARE_SERIALIZER(FAttachmentInfoNetSerializer, NETWORKREPLICATIONSUBSYSTEM_API);
+
+/** Send time at full precision for latency compensation, input frame packed, correction factor only when not 1 */
+UE_NET_DECLARE_SERIALIZER(FPredictionStateNetSerializer, NETWORKREPLICATIONSUBSYSTEM_API);
+
+/** Montage forwarded to the object serializer, play rate and start position only when not default */
+UE_NET_DECLARE_SERIALIZER(FAnimationPredictionDataNetSerializer, NETWORKREPLICATIONSUBSYSTEM_API);
+
+}
@@ -0,0 +1,86 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationNameTable.h
+// Declares ANetworkReplicationNameTable, the replicated carrier for the session name dictionary.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Info.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "NetworkReplicationNameTable.generated.h"
+
+/**
+ * One id to name mapping in the session name dictionary
+ */
+USTRUCT()
+struct FNetworkReplicationNameEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Id = INDEX_NONE;
+
+	UPROPERTY()
+	FName Name = NAME_None;
+
+	void PostReplicatedAdd(const struct FNetworkReplicationNameArray& InArraySerializer);
+};
+
+/**
+ * Append-only dictionary contents
+ * New connections receive every entry once; afterwards only newly assigned names are sent
+ */
+USTRUCT()
+struct FNetworkReplicationNameArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FNetworkReplicationNameEntry> Items;
+
+	/** Actor notified when entries arrive on clients */
+	class ANetworkReplicationNameTable* OwnerTable = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FNetworkReplicationNameEntry, FNetworkReplicationNameArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FNetworkReplicationNameArray> : public TStructOpsTypeTraitsBase2<FNetworkReplicationNameArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true
+	};
+};
+
+/**
+ * ANetworkReplicationNameTable
+ *
+ * Always relevant actor spawned by UNetworkReplicationSubsystem on the server.
+ * Replicates the session name dictionary so RPCs can send compact name ids.
+ */
+UCLASS(NotBlueprintable, Transient)
+class NETWORKREPLICATIONSUBSYSTEM_API ANetworkReplicationNameTable : public AInfo
+{
+	GENERATED_BODY()
+
+public:
+	ANetworkReplicationNameTable();
+
+	virtual void PostInitializeComponents() override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/** Server: appends a dictionary entry and pushes it to clients */
+	void AddEntry(int32 Id, FName Name);
+
+	/** Client: forwards a received entry to the local subsystem */
+	void HandleEntryReceived(int32 Id, FName Name);
+
+private:
+	UPROPERTY(Replicated)
+	FNetworkReplicationNameArray Entries;
+};
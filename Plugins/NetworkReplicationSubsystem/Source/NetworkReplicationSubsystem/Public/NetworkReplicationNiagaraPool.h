@@ -0,0 +1,78 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationNiagaraPool.h
+// Declares UNetworkReplicationNiagaraPool, a per-world pool of Niagara components for replicated effects.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NetworkReplicationNiagaraPool.generated.h"
+
+class UNiagaraComponent;
+class UNiagaraSystem;
+
+/** Components pooled for one Niagara system */
+USTRUCT()
+struct FNetworkReplicationNiagaraPoolEntry
+{
+	GENERATED_BODY()
+
+	/** Finished components ready for reuse */
+	UPROPERTY()
+	TArray<TObjectPtr<UNiagaraComponent>> Idle;
+
+	/** Playing components, oldest first, so the oldest is recycled when the system is at its cap */
+	UPROPERTY()
+	TArray<TObjectPtr<UNiagaraComponent>> Live;
+};
+
+/**
+ * Per-world pool of Niagara components used by UNetworkReplicationComponent to play replicated effects
+ * Components are registered once, returned to the pool when their system completes, and capped per system
+ * by NiagaraPoolMaxPerSystem. Systems listed in NiagaraPoolPrewarm are filled when the world begins play
+ */
+UCLASS()
+class NETWORKREPLICATIONSUBSYSTEM_API UNetworkReplicationNiagaraPool : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** Idle component for Effect, a new one while the system is under its cap, otherwise its oldest live component. Activate it after placing it */
+	UNiagaraComponent* Acquire(UNiagaraSystem* Effect);
+
+	/** Creates idle components until Effect has Count of them, within its cap */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Niagara Pool")
+	void Prewarm(UNiagaraSystem* Effect, int32 Count);
+
+	/** Destroys every pooled component, live or idle */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Niagara Pool")
+	void EmptyPool();
+
+	/** Components playing and waiting across all systems, plus acquisitions served from idle, created, and taken from a live effect */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Monitoring")
+	void GetPoolStats(int32& OutLive, int32& OutIdle, int64& OutHits, int64& OutMisses, int64& OutRecycled) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	UNiagaraComponent* CreatePooledComponent(UNiagaraSystem* Effect);
+	int32 GetMaxPerSystem() const;
+
+	UFUNCTION()
+	void OnPooledComponentFinished(UNiagaraComponent* Component);
+
+	UPROPERTY()
+	TMap<TObjectPtr<UNiagaraSystem>, FNetworkReplicationNiagaraPoolEntry> Pools;
+
+	int32 NumLive = 0;
+	int32 NumIdle = 0;
+	int64 Hits = 0;
+	int64 Misses = 0;
+	int64 Recycled = 0;
+};
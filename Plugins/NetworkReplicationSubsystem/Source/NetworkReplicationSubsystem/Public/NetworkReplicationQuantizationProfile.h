@@ -0,0 +1,36 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationQuantizationProfile.h
+// Declares UNetworkReplicationQuantizationProfile, a data asset of per-variable and per-field packing rules.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "NetworkReplicationTypes.h"
+#include "NetworkReplicationQuantizationProfile.generated.h"
+
+/**
+ * Quantization rules shared by senders and receivers
+ * Assign the same asset on every machine; packets only carry mode, bit width and component count
+ */
+UCLASS(BlueprintType)
+class NETWORKREPLICATIONSUBSYSTEM_API UNetworkReplicationQuantizationProfile : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Rules for float and vector variables, keyed by variable name */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Quantization")
+	TMap<FName, FReplicationQuantizationRule> VariableRules;
+
+	/** Rules for built-in event payloads such as trajectory and sound locations */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Quantization")
+	TMap<EReplicationQuantizedField, FReplicationQuantizationRule> EventRules;
+
+	/** Returns the rule for a variable, or null if it replicates at full precision */
+	const FReplicationQuantizationRule* FindVariableRule(FName VariableName) const;
+
+	/** Returns the rule for an event field, or null if it replicates at full precision */
+	const FReplicationQuantizationRule* FindEventRule(EReplicationQuantizedField Field) const;
+};
@@ -0,0 +1,45 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationRelayComponent.h
+// Declares the per-connection relay that carries fanned out events to a single player.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "NetworkReplicationTypes.h"
+#include "NetworkReplicationRelayComponent.generated.h"
+
+class UNetworkReplicationComponent;
+class USoundBase;
+class UNiagaraSystem;
+
+/**
+ * Added by UNetworkReplicationSubsystem to each remote player controller when event fan-out is enabled
+ * Client RPCs on it reach only that controller's connection. Each send names the component that raised the event,
+ * and playback and delegates run on that component, so listeners see fanned out events exactly like multicast ones.
+ * A send is dropped if the source component is not relevant to the receiving player
+ */
+UCLASS(NotBlueprintable, Transient)
+class NETWORKREPLICATIONSUBSYSTEM_API UNetworkReplicationRelayComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UNetworkReplicationRelayComponent();
+
+	// ===== FAN-OUT RPCs =====
+	// The location keeps the source's SoundLocation quantization, as in the sound multicasts
+	UFUNCTION(Client, Reliable)
+	void ClientPlaySoundAtLocation(UNetworkReplicationComponent* Source, USoundBase* Sound, const FQuantizedValue& Location, float VolumeMultiplier, float PitchMultiplier, float StartTime);
+
+	UFUNCTION(Client, Reliable)
+	void ClientSpawnNiagaraEffect(UNetworkReplicationComponent* Source, UNiagaraSystem* Effect, FVector Location, FRotator Rotation);
+
+	// Used unless the source component sets bReliableCosmeticEvents
+	UFUNCTION(Client, Unreliable)
+	void ClientPlaySoundAtLocationUnreliable(UNetworkReplicationComponent* Source, USoundBase* Sound, const FQuantizedValue& Location, float VolumeMultiplier, float PitchMultiplier, float StartTime);
+
+	UFUNCTION(Client, Unreliable)
+	void ClientSpawnNiagaraEffectUnreliable(UNetworkReplicationComponent* Source, UNiagaraSystem* Effect, FVector Location, FRotator Rotation);
+};
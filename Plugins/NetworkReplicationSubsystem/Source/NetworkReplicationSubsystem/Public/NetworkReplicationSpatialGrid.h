@@ -0,0 +1,66 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationSpatialGrid.h
+// Declares the uniform spatial hash used for interest management queries.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+
+/**
+ * Uniform 2D hash grid over actor locations
+ * Cells are keyed on X and Y only, since replication distance is dominated by the ground plane; queries still test full 3D distance.
+ * Add, Remove and Move are O(1), and a radius query only visits the cells it overlaps
+ */
+class NETWORKREPLICATIONSUBSYSTEM_API FNetworkReplicationSpatialGrid
+{
+public:
+	explicit FNetworkReplicationSpatialGrid(float InCellSize = 5000.0f);
+
+	/** Changes the cell size and rehashes every entry */
+	void SetCellSize(float InCellSize);
+	float GetCellSize() const { return CellSize; }
+
+	/** Returns a handle that stays valid until Remove */
+	int32 Add(AActor* Actor, const FVector& Location);
+	void Remove(int32 Handle);
+
+	/** Updates an entry's location, relinking it only when it crosses into another cell */
+	void Move(int32 Handle, const FVector& Location);
+
+	/** Appends the handles of entries within Radius of Center */
+	void QueryRadius(const FVector& Center, float Radius, TArray<int32>& OutHandles) const;
+
+	bool IsValidHandle(int32 Handle) const { return Entries.IsValidIndex(Handle) && Entries[Handle].bInUse; }
+	AActor* GetActor(int32 Handle) const;
+	const FVector& GetLocation(int32 Handle) const { return Entries[Handle].Location; }
+
+	/** Appends every live handle */
+	void GetAllHandles(TArray<int32>& OutHandles) const;
+
+	int32 Num() const { return NumEntries; }
+	int32 NumCells() const { return Cells.Num(); }
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FVector Location = FVector::ZeroVector;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+		int32 IndexInCell = INDEX_NONE;
+		bool bInUse = false;
+	};
+
+	FIntPoint GetCell(const FVector& Location) const;
+	void LinkToCell(int32 Handle);
+	void UnlinkFromCell(int32 Handle);
+
+	float CellSize;
+	TArray<FEntry> Entries;
+	TArray<int32> FreeHandles;
+	TMap<FIntPoint, TArray<int32>> Cells;
+	int32 NumEntries = 0;
+};
@@ -0,0 +1,48 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationSpawnBatchAction.h
+// Declares the latent Blueprint node that spawns a batch of replicated actors and completes with them.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "NetworkReplicationTypes.h"
+#include "NetworkReplicationSpawnBatchAction.generated.h"
+
+class UNetworkReplicationSubsystem;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSpawnBatchActionCompleted, const TArray<AActor*>&, SpawnedActors);
+
+/**
+ * Latent wrapper around UNetworkReplicationComponent::ReplicateActorSpawnBatch
+ * Completed fires once every actor exists.
+ * Cancelled fires with the actors spawned so far when the batch is cancelled or its component goes away,
+ * or straight away with no actors when the request is rejected, such as on a client
+ */
+UCLASS()
+class NETWORKREPLICATIONSUBSYSTEM_API UNetworkReplicationSpawnBatchAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(BlueprintAssignable)
+	FOnSpawnBatchActionCompleted Completed;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnSpawnBatchActionCompleted Cancelled;
+
+	/** Server: spawns each request once as a replicated actor owned by Component's owner */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Actor", meta = (BlueprintInternalUseOnly = "true"))
+	static UNetworkReplicationSpawnBatchAction* SpawnActorBatch(UNetworkReplicationComponent* Component, const TArray<FReplicationSpawnRequest>& Requests);
+
+	virtual void Activate() override;
+
+private:
+	void OnSpawnBatchEnded(FReplicationSpawnBatchHandle EndedHandle, bool bCompleted, const TArray<AActor*>& SpawnedActors);
+
+	TWeakObjectPtr<UNetworkReplicationComponent> Component;
+	TWeakObjectPtr<UNetworkReplicationSubsystem> Subsystem;
+	TArray<FReplicationSpawnRequest> Requests;
+	FReplicationSpawnBatchHandle Handle;
+};
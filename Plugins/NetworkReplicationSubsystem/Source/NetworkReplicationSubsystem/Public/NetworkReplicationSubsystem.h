@@ -7,6 +7,7 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "HAL/IConsoleManager.h"
@@ -14,9 +15,25 @@
 #include "HAL/PlatformFilemanager.h"
 #include "Engine/Console.h"
 #include "Net/UnrealNetwork.h"
+#include "UObject/ObjectKey.h"
+#include "NetworkReplicationTypes.h"
+#include "NetworkReplicationCompression.h"
+#include "NetworkReplicationSpatialGrid.h"
+#include "NetworkReplicationTransformCache.h"
+#include "NetworkReplicationComponentRegistry.h"
+#include "Components/SceneComponent.h"
 #include "NetworkReplicationSubsystem.generated.h"
 
 class UNetworkReplicationComponent;
+class UNetworkReplicationRelayComponent;
+class ANetworkReplicationNameTable;
+class UNetworkReplicationCompressionDictionary;
+class UNetConnection;
+class APlayerController;
+class UNiagaraSystem;
+
+/** A spawn batch left the queue: completed, or cancelled or dropped with the actors spawned so far */
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnSpawnBatchEnded, FReplicationSpawnBatchHandle /*Handle*/, bool /*bCompleted*/, const TArray<AActor*>& /*SpawnedActors*/);
 
 USTRUCT(BlueprintType)
 struct FNetworkReplicationSettings
@@ -32,6 +49,17 @@ struct FNetworkReplicationSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication")
 	bool bEnableCompression;
 
+	/** Custom event strings and event batches smaller than this are sent uncompressed */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Compression", meta = (ClampMin = "0"))
+	int32 CompressionThresholdBytes;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Compression")
+	EReplicationCompressionCodec CompressionCodec;
+
+	/** Shared dictionary for the ZlibDictionary codec; every machine must use the same asset */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Compression")
+	TObjectPtr<UNetworkReplicationCompressionDictionary> CompressionDictionary;
+
 	// ===== NEW OPTIMIZATION SETTINGS =====
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Optimization")
 	bool bEnableClientPrediction;
@@ -42,30 +70,107 @@ struct FNetworkReplicationSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Optimization")
 	float PredictionTolerance;
 
+	/** Server RPCs accepted per second from each connection for each RPC family. Zero disables rate limiting */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Optimization")
 	int32 MaxReplicationFrequency;
 
+	/** Calls a connection may make back to back before MaxReplicationFrequency applies */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Optimization", meta = (ClampMin = "1"))
+	int32 RPCBurstSize;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Optimization")
 	bool bEnableRelevancy;
 
+	/** Fraction of MaxReplicationDistance either side of it; actors become relevant inside the inner radius and stop beyond the outer one */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Interest", meta = (ClampMin = "0.0", ClampMax = "0.9"))
+	float RelevancyHysteresis;
+
+	/** Cell size of the interest grid over registered actors. Around a third of MaxReplicationDistance suits most maps */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Interest", meta = (ClampMin = "100.0"))
+	float InterestGridCellSize;
+
+	/** Outbound KB per second each client connection may receive from this plugin. Zero disables the send budget */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Optimization")
 	float BandwidthLimitKB;
 
+	/** Seconds of BandwidthLimitKB an idle connection can bank for a burst */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Optimization", meta = (ClampMin = "0.01"))
+	float BandwidthBurstSeconds;
+
+	/** Bytes the send scheduler may hand out per tick, charged to every client connection. Zero leaves only the send budget */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Scheduling", meta = (ClampMin = "0"))
+	int32 ScheduledBytesPerTick;
+
+	/** Queued sounds and Niagara effects older than this many seconds are dropped instead of sent */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Scheduling", meta = (ClampMin = "0.0"))
+	float MaxCosmeticEventDelay;
+
+	/** Fraction of each connection's burst that sounds and Niagara effects leave to gameplay events. They are dropped once a recipient's budget falls below it */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Scheduling", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float CosmeticBudgetReserve;
+
+	/** Scheduling weight per component ReplicationPriorityClass */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Scheduling")
+	TMap<FName, float> PriorityClasses;
+
+	/** Seconds without replication activity before an awake owner is made dormant. Zero disables automatic dormancy */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Dormancy", meta = (ClampMin = "0.0"))
+	float DormancyIdleSeconds;
+
+	/** Server: located sounds and unattached Niagara effects go only to players within the asset's audible or visible radius, instead of a multicast */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Fan-Out")
+	bool bEnableEventFanOut;
+
+	/** Most Niagara components pooled per system in each world; at the cap the oldest playing effect is reused */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Niagara Pool", meta = (ClampMin = "1"))
+	int32 NiagaraPoolMaxPerSystem;
+
+	/** Idle components created for each system when a world begins play, so the first effects allocate nothing */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Niagara Pool")
+	TMap<TSoftObjectPtr<UNiagaraSystem>, int32> NiagaraPoolPrewarm;
+
+	/** Most idle actors kept per class in each world's actor pool; releases beyond it destroy the actor */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Actor Pool", meta = (ClampMin = "0"))
+	int32 ActorPoolMaxPerClass;
+
+	/** Idle actors spawned for each class shortly after a world begins play */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Actor Pool")
+	TMap<TSoftClassPtr<AActor>, int32> ActorPoolPrewarm;
+
+	/** Actors spawned per tick across all queued spawn batches. Zero spawns every queued batch in one tick */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network Replication|Spawning", meta = (ClampMin = "0"))
+	int32 SpawnBatchActorsPerTick;
+
 	FNetworkReplicationSettings()
 		: ReplicationInterval(0.05f)
 		, MaxReplicationDistance(15000.0f)
 		, bEnableCompression(true)
+		, CompressionThresholdBytes(256)
+		, CompressionCodec(EReplicationCompressionCodec::Zlib)
+		, CompressionDictionary(nullptr)
 		, bEnableClientPrediction(true)
 		, bEnableInterestManagement(true)
 		, PredictionTolerance(0.1f)
 		, MaxReplicationFrequency(60)
+		, RPCBurstSize(10)
 		, bEnableRelevancy(true)
+		, RelevancyHysteresis(0.1f)
+		, InterestGridCellSize(5000.0f)
 		, BandwidthLimitKB(100.0f)
+		, BandwidthBurstSeconds(0.2f)
+		, ScheduledBytesPerTick(2048)
+		, MaxCosmeticEventDelay(0.25f)
+		, CosmeticBudgetReserve(0.25f)
+		, DormancyIdleSeconds(0.0f)
+		, bEnableEventFanOut(false)
+		, NiagaraPoolMaxPerSystem(32)
+		, ActorPoolMaxPerClass(32)
+		, SpawnBatchActorsPerTick(32)
 	{}
 };
 
 UCLASS(BlueprintType, Blueprintable)
-class NETWORKREPLICATIONSUBSYSTEM_API UNetworkReplicationSubsystem : public UGameInstanceSubsystem
+class NETWORKREPLICATIONSUBSYSTEM_API UNetworkReplicationSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
 {
 	GENERATED_BODY()
 
@@ -73,10 +178,21 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
-	UFUNCTION(BlueprintCallable, Category = "Network Replication|Management")
+	/** Central tick, services registered components in contiguous slices so each is visited once per ReplicationInterval */
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override;
+	virtual TStatId GetStatId() const override;
+
+	/** Components register themselves in BeginPlay; this only registers a component that has begun play and is not yet registered */
+	UE_DEPRECATED(5.6, "Components register themselves in BeginPlay, this call is no longer needed")
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Management", meta = (DeprecatedFunction, DeprecationMessage = "Components register themselves in BeginPlay, this call is no longer needed"))
 	void RegisterReplicationComponent(UNetworkReplicationComponent* Component);
 
-	UFUNCTION(BlueprintCallable, Category = "Network Replication|Management")
+	/** Components unregister themselves in EndPlay; unregistering a registered component early is still allowed */
+	UE_DEPRECATED(5.6, "Components unregister themselves in EndPlay, this call is no longer needed")
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Management", meta = (DeprecatedFunction, DeprecationMessage = "Components unregister themselves in EndPlay, this call is no longer needed"))
 	void UnregisterReplicationComponent(UNetworkReplicationComponent* Component);
 
 	UFUNCTION(BlueprintCallable, Category = "Network Replication|Optimization")
@@ -91,6 +207,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Network Replication|Monitoring")
 	int32 GetActiveReplicationCount() const;
 
+	/** Registered components, registry slots allocated, and slots free for reuse */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Monitoring")
+	void GetRegistryStats(int32& OutLive, int32& OutSlots, int32& OutFreeSlots) const;
+
 	UFUNCTION(BlueprintCallable, Category = "Network Replication|Monitoring")
 	float GetReplicationBandwidth() const;
 
@@ -111,6 +231,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Network Replication|Performance")
 	float GetAverageLatency() const;
 
+	/** Replications recorded for one RPC family since the last stats reset, with min, max and average send intervals */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Performance")
+	FReplicationFamilyStats GetReplicationFamilyStats(EReplicationRPCFamily Family) const;
+
+	/** Updates the running aggregates when a registered component replicates; PreviousTime is its last replication time before this one */
+	void RecordComponentReplication(EReplicationRPCFamily Family, float PreviousTime, float NewTime);
+
 	UFUNCTION(BlueprintCallable, Category = "Network Replication|Performance")
 	void OptimizeForBandwidth(float MaxBandwidthKB);
 
@@ -167,6 +294,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Network Replication|Interest")
 	void RemoveInterestActor(AActor* Actor);
 
+	/** True for actors added with AddInterestActor, which UNetworkReplicationGraph keeps relevant to every connection */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Interest")
+	bool IsInterestActor(AActor* Actor) const;
+
+	/** Changes whenever a setting or interest actor that affects relevancy changes, so replication graph nodes know to re-route */
+	int32 GetRelevancyRevision() const { return RelevancyRevision; }
+
+	/** Owners of registered components relevant to Viewer. Remembers the result so actors near MaxReplicationDistance do not flap */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Interest")
+	void GetRelevantActors(AActor* Viewer, TArray<AActor*>& OutActors);
+
 	// ===== PHASE 3: ADVANCED PERFORMANCE MONITORING =====
 	UFUNCTION(BlueprintCallable, Category = "Network Replication|Performance|Advanced")
 	void StartPerformanceMonitoring();
@@ -223,19 +361,223 @@ public:
 	void ResetAllSimulations();
 
 
+	// ===== SESSION NAME DICTIONARY =====
+	/** Builds the wire form of a name. The server assigns ids; clients reuse ids they have already received */
+	FReplicatedNameId MakeReplicatedName(UWorld* World, FName Name);
+
+	/** Resolves a name received from the network. Returns false if its dictionary entry has not arrived yet */
+	bool ResolveReplicatedName(const FReplicatedNameId& NetName, FName& OutName) const;
+
+	/** Client: Component's parked events are replayed once the dictionary entry for NameId arrives */
+	void WaitForReplicatedName(UNetworkReplicationComponent* Component, int32 NameId);
+	void StopWaitingForReplicatedName(UNetworkReplicationComponent* Component);
+
+	/** Client: records a dictionary entry received from the server */
+	void RegisterReplicatedName(int32 NameId, FName Name);
+
+	/** Client: forgets every learned id, called when a new session's table arrives */
+	void ResetReplicatedNames();
+
+	/** Names in the table and ids sent in place of full names. Bytes saved is estimated from name lengths, not measured on the wire */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Monitoring")
+	void GetNameTableStats(int32& OutNameCount, int64& OutIdSends, int64& OutBytesSaved) const;
+
+	// ===== SERVER RPC RATE LIMITING =====
+	/** Server: takes a token from the connection's bucket for Family. Returns false when the call must be dropped or coalesced */
+	bool ConsumeRPCToken(UNetConnection* Connection, EReplicationRPCFamily Family);
+
+	/** Server: counts a call rejected by ConsumeRPCToken */
+	void RecordRateLimitedRPC(EReplicationRPCFamily Family, bool bCoalesced);
+
+	/** Server: true the first time Connection sends a name id the dictionary never assigned */
+	bool ShouldWarnUnknownName(UNetConnection* Connection);
+
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Monitoring")
+	void GetRateLimitStats(EReplicationRPCFamily Family, int64& OutDropped, int64& OutCoalesced) const;
+
+	// ===== SEND BUDGET =====
+	/** Server: charges a multicast from Actor to every connection with a channel for it. Returns false, charging nothing, when a non-critical send must wait for the budget to refill */
+	bool ConsumeSendBudget(AActor* Actor, int32 Bytes, EReplicationSendPriority Priority);
+
+	/** Server: as ConsumeSendBudget, for a send that only reaches Connection */
+	bool ConsumeConnectionSendBudget(UNetConnection* Connection, int32 Bytes, EReplicationSendPriority Priority);
+
+	/** Server: counts bytes held back or discarded because the send budget was spent */
+	void RecordBudgetedBytes(int32 Bytes, bool bDropped);
+
+	/** Bytes charged across all connections, bytes deferred at least one tick, and bytes dropped */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Monitoring")
+	void GetSendBudgetStats(int64& OutSpentBytes, int64& OutDeferredBytes, int64& OutDroppedBytes) const;
+
+	// ===== SEND SCHEDULER =====
+	/** Server: queues Component to send its outbound events. Called when its queue goes from empty to non-empty */
+	void ScheduleComponent(UNetworkReplicationComponent* Component);
+
+	/** Priority class weight scaled by distance to the nearest player */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Scheduling")
+	float GetComponentPriority(const UNetworkReplicationComponent* Component) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Monitoring")
+	int32 GetScheduledComponentCount() const;
+
+	// ===== NET DORMANCY =====
+	float GetDormancyIdleSeconds() const { return CurrentSettings.DormancyIdleSeconds; }
+
+	/** Server: counts an owner put to sleep or woken by automatic dormancy */
+	void RecordDormancyTransition(bool bDormant);
+
+	/** Server: drops a dormant owner from the count without counting a wake, when its components end play */
+	void ForgetDormantOwner();
+
+	/** Registered owners currently dormant and awake, plus total transitions since the last stats reset */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Monitoring")
+	void GetDormancyStats(int32& OutDormantOwners, int32& OutAwakeOwners, int64& OutSleeps, int64& OutWakes) const;
+
+	// ===== EVENT FAN-OUT =====
+	bool IsEventFanOutEnabled() const { return CurrentSettings.bEnableEventFanOut; }
+
+	/** Distance beyond which owners are not relevant, zero when relevancy is disabled */
+	float GetRelevancyCullDistance() const { return CurrentSettings.bEnableRelevancy ? CurrentSettings.MaxReplicationDistance : 0.0f; }
+
+	/** Server: player controllers whose view location, as of this tick, lies within Radius of Location */
+	void GatherEventAudience(const FVector& Location, float Radius, TArray<APlayerController*>& OutAudience) const;
+
+	/** Server: relay on PlayerController that carries targeted client sends, added on first use */
+	UNetworkReplicationRelayComponent* GetConnectionRelay(APlayerController* PlayerController);
+
+	/** Server: counts one fanned out event and the sends it made */
+	void RecordFanOut(int32 NumSends, int32 NumSkipped);
+
+	/** Events delivered by fan-out, the targeted sends they made, and the connections they skipped since the last stats reset */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Monitoring")
+	void GetFanOutStats(int64& OutEvents, int64& OutSends, int64& OutSkippedConnections) const;
+
+	// ===== NIAGARA POOL =====
+	int32 GetNiagaraPoolMaxPerSystem() const { return CurrentSettings.NiagaraPoolMaxPerSystem; }
+	const TMap<TSoftObjectPtr<UNiagaraSystem>, int32>& GetNiagaraPoolPrewarm() const { return CurrentSettings.NiagaraPoolPrewarm; }
+
+	// ===== ACTOR POOL =====
+	int32 GetActorPoolMaxPerClass() const { return CurrentSettings.ActorPoolMaxPerClass; }
+	const TMap<TSoftClassPtr<AActor>, int32>& GetActorPoolPrewarm() const { return CurrentSettings.ActorPoolPrewarm; }
+
+	// ===== BATCH SPAWNING =====
+	/** Server: queues Requests to be spawned for Requester, whose OnActorBatchSpawned fires once the whole batch exists */
+	FReplicationSpawnBatchHandle QueueSpawnBatch(UNetworkReplicationComponent* Requester, const TArray<FReplicationSpawnRequest>& Requests);
+
+	/** True while the batch still has actors left to spawn */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Spawning")
+	bool IsSpawnBatchPending(FReplicationSpawnBatchHandle Handle) const;
+
+	/** Stops a pending batch. Actors already spawned are kept and passed to the requester's OnActorBatchCancelled */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Spawning")
+	bool CancelSpawnBatch(FReplicationSpawnBatchHandle Handle);
+
+	/** Fires for every batch that leaves the queue, including batches dropped because their requester went away */
+	FOnSpawnBatchEnded OnSpawnBatchEnded;
+
+	// ===== PAYLOAD COMPRESSION =====
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Compression")
+	FReplicationCompressionStats GetCompressionStats(EReplicationPayloadCategory Category) const;
+
+	/** Records payloads as they are sent so a dictionary can be trained from real traffic */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Compression")
+	void StartCompressionCapture();
+
+	/** Stops recording and writes the samples for UNetworkReplicationCompressionDictionary::SampleFile. Empty path uses Saved/NetworkReplication */
+	UFUNCTION(BlueprintCallable, Category = "Network Replication|Compression")
+	bool StopCompressionCapture(const FString& FilePath);
+
+	FNetworkReplicationCompressor& GetPayloadCompressor() { return PayloadCompressor; }
+
 	// Console command implementations removed for simplicity
 
 private:
-	UPROPERTY()
-	TArray<UNetworkReplicationComponent*> RegisteredComponents;
+	friend class UNetworkReplicationComponent;
+
+	/** Called only from the component's BeginPlay and EndPlay, which keeps the registry's raw pointers paired with a live component */
+	void AddRegisteredComponent(UNetworkReplicationComponent* Component);
+	void RemoveRegisteredComponent(UNetworkReplicationComponent* Component);
+
+	/** Registered components; each holds its slot handle, and every component unregisters in EndPlay before it can be collected */
+	FNetworkReplicationComponentRegistry ComponentRegistry;
 
 	/** Motion matching components */
 
+	UPROPERTY()
 	FNetworkReplicationSettings CurrentSettings;
 
+	/** Compresses custom event strings and event batches according to CurrentSettings */
+	FNetworkReplicationCompressor PayloadCompressor;
+
 	/** Interest management system data */
 	UPROPERTY()
-	TArray<AActor*> InterestActors;
+	TSet<TObjectPtr<AActor>> InterestActors;
+
+	/** Spatial hash over owners of registered components, kept current through their root component's TransformUpdated */
+	FNetworkReplicationSpatialGrid InterestGrid;
+
+	struct FInterestEntry
+	{
+		int32 GridHandle = INDEX_NONE;
+		int32 NumComponents = 0;
+		TWeakObjectPtr<USceneComponent> Root;
+		FDelegateHandle MoveHandle;
+		/** Index into TransformCache, INDEX_NONE until the next refresh */
+		int32 CacheIndex = INDEX_NONE;
+	};
+
+	TMap<TObjectKey<AActor>, FInterestEntry> InterestEntries;
+
+	/** Grid handles each viewer found relevant in its last query, the state behind the hysteresis band */
+	TMap<TObjectKey<AActor>, TSet<int32>> ViewerRelevantHandles;
+
+	void AddInterestEntry(AActor* Owner);
+	void RemoveInterestEntry(AActor* Owner);
+	void OnOwnerTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, int32 GridHandle);
+	void GetRelevancyRadii(float& OutInnerRadius, float& OutOuterRadius) const;
+	int32 RelevancyRevision = 0;
+
+	/** Per-frame snapshot of interest entry positions and bounds radii, rebuilt at the start of Tick */
+	FNetworkReplicationTransformCache TransformCache;
+
+	/** Squared distance from each TransformCache entry to the nearest viewer, empty when there are no viewers */
+	TArray<float> NearestViewerDistancesSquared;
+	int32 NumCachedViewers = 0;
+
+	/** Player controllers and where they view from, rebuilt with TransformCache for event fan-out */
+	struct FCachedViewer
+	{
+		TWeakObjectPtr<APlayerController> PlayerController;
+		FVector ViewLocation = FVector::ZeroVector;
+	};
+
+	TArray<FCachedViewer> CachedViewers;
+
+	/** Relay components added to remote player controllers for targeted sends */
+	TMap<TObjectKey<APlayerController>, TWeakObjectPtr<UNetworkReplicationRelayComponent>> ConnectionRelays;
+
+	/** A spawn batch and the actors spawned for it so far, in request order */
+	struct FPendingSpawnBatch
+	{
+		FReplicationSpawnBatchHandle Handle;
+		TWeakObjectPtr<UNetworkReplicationComponent> Requester;
+		TArray<FReplicationSpawnRequest> Requests;
+		TArray<TWeakObjectPtr<AActor>> SpawnedActors;
+	};
+
+	/** Spawn batches in the order they were queued; only the front one spawns until it completes */
+	TArray<FPendingSpawnBatch> PendingSpawnBatches;
+	int32 LastSpawnBatchId = 0;
+	int64 BatchSpawnedActors = 0;
+
+	void ProcessSpawnBatches();
+	int32 FindSpawnBatch(FReplicationSpawnBatchHandle Handle) const;
+	void EndSpawnBatch(int32 BatchIndex, bool bCompleted);
+
+	void RefreshTransformCache();
+
+	/** Times the vector and scalar culling kernels against synthetic caches of increasing size */
+	void RunRelevancyBenchmark() const;
 
 	/** Network profiling and simulation state */
 	bool bNetworkProfilingActive;
@@ -271,5 +613,99 @@ private:
 	TArray<float> PerformanceData;
 	float PerformanceMeasurementStartTime;
 
+	/** Session name dictionary */
+	TMap<FName, int32> NameToId;
+	TArray<FName> IdToName;
+	
+	/** Server: estimated bytes saved each time an id replaces the full name */
+	TArray<int32> NameIdSavings;
+	
+	/** Components with parked events and the name id at the front of each queue */
+	TMap<TWeakObjectPtr<UNetworkReplicationComponent>, int32> NameWaiters;
+	
+	TWeakObjectPtr<ANetworkReplicationNameTable> NameTableActor;
+	int64 NameIdSends;
+	int64 NameIdBytesSavedEstimate;
+	bool bWarnedNameTableFull;
+
+	ANetworkReplicationNameTable* GetOrSpawnNameTable(UWorld* World);
+
+	/** Server RPC rate limiting, one bucket per connection and RPC family */
+	struct FRPCTokenBucket
+	{
+		double Tokens = 0.0;
+		double LastRefillTime = 0.0;
+	};
+
+	struct FConnectionRPCBuckets
+	{
+		FRPCTokenBucket Buckets[static_cast<int32>(EReplicationRPCFamily::Count)];
+		bool bWarnedUnknownName = false;
+	};
+
+	TMap<TObjectKey<UNetConnection>, FConnectionRPCBuckets> RPCTokenBuckets;
+	double LastRPCBucketPruneTime;
+	int64 RateLimitedDrops[static_cast<int32>(EReplicationRPCFamily::Count)];
+	int64 RateLimitedCoalesced[static_cast<int32>(EReplicationRPCFamily::Count)];
+
+	/** Outbound send budget per client connection in bytes, refilled every world tick and allowed to go negative for critical sends */
+	TMap<TObjectKey<UNetConnection>, double> SendBudgets;
+	bool ChargeConnections(TArrayView<UNetConnection* const> Connections, int32 Bytes, EReplicationSendPriority Priority);
+	FDelegateHandle WorldTickStartHandle;
+	int64 SendBudgetSpentBytes;
+	int64 SendBudgetDeferredBytes;
+	int64 SendBudgetDroppedBytes;
+
+	/** Owners automatic dormancy has put to sleep, and transitions counted since the last stats reset */
+	int32 NumDormantOwners;
+	int64 DormancySleeps;
+	int64 DormancyWakes;
+
+	/** Fanned out events, the targeted sends they made and the connections they skipped, since the last stats reset */
+	int64 FanOutEvents;
+	int64 FanOutSends;
+	int64 FanOutSkippedConnections;
+
+	/**
+	 * Running aggregates over registered components, so the performance queries never walk the registry
+	 * Totals follow registration: a component's counts are added when it registers and taken away when it leaves
+	 */
+	int64 AggregateReplications;
+	double AggregateReplicationTimeSum;
+	int32 NumReplicatedComponents;
+	FReplicationFamilyStats FamilyStats[static_cast<int32>(EReplicationRPCFamily::Count)];
+
+	void AddComponentAggregates(const UNetworkReplicationComponent* Component, int32 Sign);
+	void ResetReplicationAggregates();
+
+	/** Central tick cursor into ComponentRegistry and fractional components owed to the next slice */
+	int32 NextComponentTickIndex;
+	float ComponentTickCarry;
+
+	/** Measured outbound rate, sampled once per second by the central tick */
+	int64 BandwidthWindowBytes;
+	float BandwidthWindowSeconds;
+	float MeasuredBandwidthKB;
+
+	void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	/**
+	 * Send scheduler, a min-heap of components with queued events
+	 * Priority accumulates while a component waits, and it is due once Priority * Waited reaches ReplicationInterval.
+	 * That moment is fixed when the component is queued, so ordering by it keeps each pick O(log n) without re-scoring every entry
+	 */
+	struct FScheduledComponent
+	{
+		double SendDeadline = 0.0;
+		TWeakObjectPtr<UNetworkReplicationComponent> Component;
+
+		bool operator<(const FScheduledComponent& Other) const { return SendDeadline < Other.SendDeadline; }
+	};
+
+	TArray<FScheduledComponent> SendSchedule;
+	FDelegateHandle WorldPostActorTickHandle;
+
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
 	void OnComponentDestroyed(UNetworkReplicationComponent* Component);
 };
\ No newline at end of file
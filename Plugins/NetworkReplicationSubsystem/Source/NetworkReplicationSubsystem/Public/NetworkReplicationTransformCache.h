@@ -0,0 +1,56 @@
+// Copyright © 2025 Millsy.dev. All Rights Reserved.
+//
+// NetworkReplicationTransformCache.h
+// Declares the structure-of-arrays snapshot of registered actor positions and its batched culling kernels.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+
+/**
+ * Positions and bounding radii of registered actors, one array per component, rebuilt once per tick
+ * Lets relevancy tests stream through contiguous floats instead of chasing actor pointers, and test four entries per instruction.
+ * Positions are stored in single precision, which is ample for distance culling
+ */
+class NETWORKREPLICATIONSUBSYSTEM_API FNetworkReplicationTransformCache
+{
+public:
+	/** Entries processed per vector instruction; the arrays are padded to a multiple of this */
+	static constexpr int32 LaneWidth = 4;
+
+	static int32 NumMaskWords(int32 InNumEntries) { return (InNumEntries + 31) / 32; }
+
+	void Reset(int32 ExpectedNum = 0);
+	int32 Add(AActor* Actor, const FVector& Location, float Radius);
+
+	/** Pads the arrays to LaneWidth. Call once after the last Add and before culling */
+	void Finalize();
+
+	int32 Num() const { return NumEntries; }
+	AActor* GetActor(int32 Index) const { return Actors[Index].Get(); }
+	FVector GetLocation(int32 Index) const { return FVector(X[Index], Y[Index], Z[Index]); }
+
+	/**
+	 * Tests every entry against a sphere around ViewLocation
+	 * Entry i passes when it is within CullDistance plus its radius. OutMask gets bit i % 32 of word i / 32, and
+	 * OutDistancesSquared the squared distance from ViewLocation to each entry
+	 */
+	void CullSphere(const FVector& ViewLocation, float CullDistance, TArray<uint32>& OutMask, TArray<float>& OutDistancesSquared) const;
+
+	/** Same test one entry at a time, the reference the vector kernel is benchmarked against */
+	void CullSphereScalar(const FVector& ViewLocation, float CullDistance, TArray<uint32>& OutMask, TArray<float>& OutDistancesSquared) const;
+
+	/** Lowers each of the Num() entries of InOutNearestSquared to the squared distance from ViewLocation when that is closer */
+	void AccumulateNearestDistanceSquared(const FVector& ViewLocation, TArray<float>& InOutNearestSquared) const;
+
+private:
+	TArray<float, TAlignedHeapAllocator<16>> X;
+	TArray<float, TAlignedHeapAllocator<16>> Y;
+	TArray<float, TAlignedHeapAllocator<16>> Z;
+	TArray<float, TAlignedHeapAllocator<16>> Radii;
+	TArray<TWeakObjectPtr<AActor>> Actors;
+	int32 NumEntries = 0;
+};
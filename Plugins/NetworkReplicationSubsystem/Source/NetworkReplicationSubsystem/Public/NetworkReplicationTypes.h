@@ -9,8 +9,12 @@
 #include "Engine/Engine.h"
 #include "Components/SceneComponent.h"
 #include "GameFramework/Actor.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "StructUtils/InstancedStruct.h"
 #include "NetworkReplicationTypes.generated.h"
 
+class UNetworkReplicationComponent;
+
 /**
  * Attachment information for hot joining support
  * When replicated, this struct allows late-joining clients to properly attach actors
@@ -126,3 +130,549 @@ struct NETWORKREPLICATIONSUBSYSTEM_API FAnimationPredictionData
 		bIsValid = false;
 	}
 };
+
+/**
+ * Server RPC groups that share a rate limit token bucket per connection
+ */
+UENUM(BlueprintType)
+enum class EReplicationRPCFamily : uint8
+{
+	Animation,
+	Sound,
+	ActorSpawn,
+	NiagaraEffect,
+	Variable,
+	CustomEvent,
+	State,
+	MotionMatching,
+	Count UMETA(Hidden)
+};
+
+/**
+ * Running replication totals for one RPC family, updated as each replication is recorded
+ * Intervals are the time since the same component last replicated, so a component's first send adds no interval
+ */
+USTRUCT(BlueprintType)
+struct NETWORKREPLICATIONSUBSYSTEM_API FReplicationFamilyStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Network Replication")
+	int64 Replications = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Network Replication")
+	int64 Intervals = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Network Replication")
+	double IntervalSumSeconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Network Replication")
+	float MinIntervalSeconds = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Network Replication")
+	float MaxIntervalSeconds = 0.0f;
+
+	float GetAverageIntervalSeconds() const { return Intervals > 0 ? static_cast<float>(IntervalSumSeconds / Intervals) : 0.0f; }
+};
+
+/**
+ * How an outbound server send is treated once a connection's send budget is spent
+ */
+UENUM(BlueprintType)
+enum class EReplicationSendPriority : uint8
+{
+	/** Cosmetic events, dropped while the budget is spent */
+	Low,
+	/** Gameplay events, deferred to a later tick while the budget is spent */
+	Normal,
+	/** Movement and state, always sent but still charged so lower priorities back off */
+	Critical
+};
+
+/** Approximate wire sizes used to charge sends against the per-connection budget */
+namespace ReplicationWireSize
+{
+	constexpr int32 RPCHeader = 4;
+	constexpr int32 ObjectReference = 4;
+	constexpr int32 Vector = 12;
+	constexpr int32 Rotator = 6;
+}
+
+/**
+ * How a quantization rule packs each component
+ */
+UENUM(BlueprintType)
+enum class EReplicationQuantizationMode : uint8
+{
+	/** Full precision */
+	None,
+	/** Signed multiples of Scale, e.g. 0.1 cm steps */
+	FixedPoint,
+	/** Evenly spaced steps between RangeMin and RangeMax */
+	Range,
+	/** Octahedral unit vector in two components, e.g. 2x11 bits */
+	UnitNormal,
+	/** Angles in degrees wrapped to [0, 360), e.g. 16 bits per axis */
+	Angle,
+	Count UMETA(Hidden)
+};
+
+/**
+ * Event payload fields that a quantization profile can bind rules to
+ */
+UENUM(BlueprintType)
+enum class EReplicationQuantizedField : uint8
+{
+	TrajectoryPosition,
+	TrajectoryRotation,
+	SoundLocation
+};
+
+/**
+ * Bit-packed form of a float, vector or rotator
+ * The header records mode, bit width and component count; scales and ranges come from the receiver's profile
+ */
+USTRUCT()
+struct NETWORKREPLICATIONSUBSYSTEM_API FQuantizedValue
+{
+	GENERATED_BODY()
+
+	/** Full precision value on the sender, decoded value on receivers. Rotators are stored as (Pitch, Yaw, Roll) */
+	FVector Value = FVector::ZeroVector;
+
+	uint32 Packed[3] = { 0, 0, 0 };
+
+	EReplicationQuantizationMode Mode = EReplicationQuantizationMode::None;
+
+	uint8 BitsPerComponent = 0;
+
+	uint8 NumComponents = 0;
+
+	bool IsQuantized() const { return Mode != EReplicationQuantizationMode::None; }
+
+	int32 GetEstimatedWireBytes() const;
+
+	/** Writes only the packed header and components, for payloads that already flagged quantization */
+	void SerializePacked(FArchive& Ar);
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FQuantizedValue> : public TStructOpsTypeTraitsBase2<FQuantizedValue>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/**
+ * One quantization rule from a UNetworkReplicationQuantizationProfile
+ */
+USTRUCT(BlueprintType)
+struct NETWORKREPLICATIONSUBSYSTEM_API FReplicationQuantizationRule
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quantization")
+	EReplicationQuantizationMode Mode = EReplicationQuantizationMode::None;
+
+	/** Bits written per component */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quantization", meta = (ClampMin = "1", ClampMax = "32"))
+	int32 BitsPerComponent = 16;
+
+	/** Step size for FixedPoint */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quantization", meta = (EditCondition = "Mode == EReplicationQuantizationMode::FixedPoint"))
+	float Scale = 0.1f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quantization", meta = (EditCondition = "Mode == EReplicationQuantizationMode::Range"))
+	float RangeMin = -1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quantization", meta = (EditCondition = "Mode == EReplicationQuantizationMode::Range"))
+	float RangeMax = 1.0f;
+
+	/** Packs Value; NumComponents is 1 for scalars and 3 for vectors and rotators. Returns false if the rule does not apply */
+	bool Quantize(const FVector& Value, int32 NumComponents, FQuantizedValue& OutValue) const;
+
+	/** Decodes a packed value produced by Quantize with the same rule */
+	FVector Dequantize(const FQuantizedValue& Value) const;
+
+private:
+	uint32 QuantizeComponent(double Component) const;
+	double DequantizeComponent(uint32 Packed) const;
+};
+
+/**
+ * Type tag for replicated variable payloads
+ * Values match the VariableType integers previously sent alongside string payloads
+ */
+UENUM(BlueprintType)
+enum class EReplicatedVariableType : uint8
+{
+	String,
+	Float,
+	Int,
+	Bool,
+	Vector,
+	Count UMETA(Hidden)
+};
+
+/**
+ * Typed variable payload for binary replication
+ * Only the member selected by Type is written to the wire, so numeric values travel as raw bits
+ */
+USTRUCT(BlueprintType)
+struct NETWORKREPLICATIONSUBSYSTEM_API FReplicatedVariableValue
+{
+	GENERATED_BODY()
+
+	/** Which value member is active */
+	UPROPERTY(BlueprintReadOnly, Category = "Variables")
+	EReplicatedVariableType Type = EReplicatedVariableType::String;
+
+	/** String payload, only allocated for string variables */
+	UPROPERTY(BlueprintReadOnly, Category = "Variables")
+	FString StringValue;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Variables")
+	float FloatValue = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Variables")
+	int32 IntValue = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Variables")
+	bool BoolValue = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Variables")
+	FVector VectorValue = FVector::ZeroVector;
+
+	/** Packed float or vector, sent instead of the raw value when a quantization rule applies */
+	FQuantizedValue Quantized;
+
+	static FReplicatedVariableValue MakeString(const FString& Value);
+	static FReplicatedVariableValue MakeFloat(float Value);
+	static FReplicatedVariableValue MakeInt(int32 Value);
+	static FReplicatedVariableValue MakeBool(bool Value);
+	static FReplicatedVariableValue MakeVector(const FVector& Value);
+
+	/** Text form of the active value, for logging and the string-based delegate */
+	FString ToString() const;
+
+	/** Compares type and active member only */
+	bool Equals(const FReplicatedVariableValue& Other) const;
+
+	/** Approximate serialized size of the active value */
+	int32 GetEstimatedWireBytes() const;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FReplicatedVariableValue> : public TStructOpsTypeTraitsBase2<FReplicatedVariableValue>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/**
+ * Change detection settings for a replicated variable
+ * A new value is sent only when it differs from the last sent value by more than the epsilons,
+ * and no more often than MinResendInterval; values held back by the interval are sent once it elapses
+ */
+USTRUCT(BlueprintType)
+struct NETWORKREPLICATIONSUBSYSTEM_API FReplicatedVariableThreshold
+{
+	GENERATED_BODY()
+
+	/** Absolute difference (or vector distance) treated as unchanged */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Variables", meta = (ClampMin = "0.0"))
+	float AbsoluteEpsilon = 0.0f;
+
+	/** Difference relative to the larger magnitude treated as unchanged, e.g. 0.01 for 1% */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Variables", meta = (ClampMin = "0.0"))
+	float RelativeEpsilon = 0.0f;
+
+	/** Minimum seconds between two sends of the same variable */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Variables", meta = (ClampMin = "0.0"))
+	float MinResendInterval = 0.0f;
+
+	/** True if Candidate is close enough to Previous to skip sending it */
+	bool IsUnchanged(const FReplicatedVariableValue& Previous, const FReplicatedVariableValue& Candidate) const;
+};
+
+/**
+ * Keyed entry of a component's persistent variable store
+ */
+USTRUCT(BlueprintType)
+struct NETWORKREPLICATIONSUBSYSTEM_API FReplicatedVariableItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Variables")
+	FName VariableName = NAME_None;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Variables")
+	FReplicatedVariableValue Value;
+
+	/** State store only: the owning client's write sequence this value came from, zero when the server wrote it */
+	UPROPERTY()
+	uint16 SourceSequence = 0;
+
+	void PostReplicatedAdd(const struct FReplicatedVariableArray& InArraySerializer);
+	void PostReplicatedChange(const struct FReplicatedVariableArray& InArraySerializer);
+};
+
+/**
+ * Persistent variable store for hot joining support
+ * Only changed entries are sent, and newly relevant clients receive every entry in their initial bunch
+ */
+USTRUCT()
+struct NETWORKREPLICATIONSUBSYSTEM_API FReplicatedVariableArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FReplicatedVariableItem> Items;
+
+	/** Component notified when entries arrive on clients */
+	UNetworkReplicationComponent* OwnerComponent = nullptr;
+
+	const FReplicatedVariableValue* FindValue(FName VariableName) const;
+
+	/** Writes a value and marks its entry dirty. Returns false if the stored value was already equal */
+	bool SetValue(FName VariableName, const FReplicatedVariableValue& Value, uint16 SourceSequence = 0);
+
+	// Replication moves items around on clients, so the name map is dropped and rebuilt on the next lookup
+	void PreReplicatedRemove(const TArrayView<int32>& RemovedIndices, int32 FinalSize) { ItemIndices.Reset(); }
+	void PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize) { ItemIndices.Reset(); }
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FReplicatedVariableItem, FReplicatedVariableArray>(Items, DeltaParms, *this);
+	}
+
+private:
+	/** Index into Items per variable name, so lookups do not scan the store */
+	mutable TMap<FName, int32> ItemIndices;
+
+	int32 FindItemIndex(FName VariableName) const;
+};
+
+template<>
+struct TStructOpsTypeTraits<FReplicatedVariableArray> : public TStructOpsTypeTraitsBase2<FReplicatedVariableArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true
+	};
+};
+
+/**
+ * Name sent through the session name dictionary
+ * Carries a compact varint id once the server has assigned one, and falls back to the full FName otherwise
+ */
+USTRUCT()
+struct NETWORKREPLICATIONSUBSYSTEM_API FReplicatedNameId
+{
+	GENERATED_BODY()
+
+	/** Dictionary id, INDEX_NONE when the name travels in full */
+	UPROPERTY()
+	int32 Id = INDEX_NONE;
+
+	/** Full name; left as NAME_None on receipt of an id until resolved through the subsystem */
+	UPROPERTY()
+	FName Name = NAME_None;
+
+	FReplicatedNameId() = default;
+
+	explicit FReplicatedNameId(FName InName)
+		: Name(InName)
+	{}
+
+	FReplicatedNameId(int32 InId, FName InName)
+		: Id(InId)
+		, Name(InName)
+	{}
+
+	bool HasId() const { return Id != INDEX_NONE; }
+
+	int32 GetEstimatedWireBytes() const;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FReplicatedNameId> : public TStructOpsTypeTraitsBase2<FReplicatedNameId>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/**
+ * String payload compressed on the wire once it exceeds the subsystem's compression threshold
+ */
+USTRUCT()
+struct NETWORKREPLICATIONSUBSYSTEM_API FReplicationCompressedString
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString Value;
+
+	FReplicationCompressedString() = default;
+	FReplicationCompressedString(const FString& InValue) : Value(InValue) {}
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FReplicationCompressedString> : public TStructOpsTypeTraitsBase2<FReplicationCompressedString>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/**
+ * Event kinds that can be coalesced into a single batched multicast
+ */
+UENUM(BlueprintType)
+enum class EReplicationEventType : uint8
+{
+	Sound,
+	SoundAtLocation,
+	NiagaraEffect,
+	Variable,
+	CustomEvent,
+	StructEvent,
+	Count UMETA(Hidden)
+};
+
+/**
+ * One queued event inside a batch
+ * Only the fields used by Type are written to the wire
+ */
+USTRUCT()
+struct NETWORKREPLICATIONSUBSYSTEM_API FReplicationBatchedEvent
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	EReplicationEventType Type = EReplicationEventType::CustomEvent;
+
+	/** Variable or event name, or the attach socket for Niagara effects */
+	UPROPERTY()
+	FReplicatedNameId Name;
+
+	/** Sound or Niagara system */
+	UPROPERTY()
+	TObjectPtr<UObject> Asset = nullptr;
+
+	UPROPERTY()
+	FVector Location = FVector::ZeroVector;
+
+	/** Sound location, packed through the sender's quantization profile */
+	UPROPERTY()
+	FQuantizedValue QuantizedLocation;
+
+	UPROPERTY()
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	/** Volume, pitch and start time for sounds */
+	UPROPERTY()
+	float VolumeMultiplier = 1.0f;
+
+	UPROPERTY()
+	float PitchMultiplier = 1.0f;
+
+	UPROPERTY()
+	float StartTime = 0.0f;
+
+	UPROPERTY()
+	bool bAttachToOwner = false;
+
+	UPROPERTY()
+	FReplicatedVariableValue Value;
+
+	/** Custom event payload */
+	UPROPERTY()
+	FString Data;
+
+	/** Struct event payload */
+	UPROPERTY()
+	FInstancedStruct Payload;
+
+	/** Server world time the event was queued for sending. Not replicated */
+	double QueuedTime = 0.0;
+
+	/** Sounds and Niagara effects are cosmetic; everything else is gameplay data */
+	EReplicationSendPriority GetSendPriority() const;
+
+	/** Approximate size of this event sent as its own multicast */
+	int32 GetEstimatedWireBytes() const;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+/**
+ * Events queued by a component during one frame and sent as a single multicast
+ * Receivers replay the events in their original order. The encoded events are compressed as one buffer
+ */
+USTRUCT()
+struct NETWORKREPLICATIONSUBSYSTEM_API FReplicationEventBatch
+{
+	GENERATED_BODY()
+
+	/** Upper bound accepted when reading, protects clients from malformed counts */
+	static constexpr int32 MaxEvents = 1024;
+
+	UPROPERTY()
+	TArray<FReplicationBatchedEvent> Events;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+private:
+	bool SerializeEvents(FArchive& Ar, class UPackageMap* Map);
+};
+
+template<>
+struct TStructOpsTypeTraits<FReplicationEventBatch> : public TStructOpsTypeTraitsBase2<FReplicationEventBatch>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/** One actor to spawn as part of a batch */
+USTRUCT(BlueprintType)
+struct NETWORKREPLICATIONSUBSYSTEM_API FReplicationSpawnRequest
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawning")
+	TSubclassOf<AActor> ActorClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawning")
+	FTransform Transform;
+};
+
+/** Identifies a queued spawn batch. Zero is never issued */
+USTRUCT(BlueprintType)
+struct NETWORKREPLICATIONSUBSYSTEM_API FReplicationSpawnBatchHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Spawning")
+	int32 Id = 0;
+
+	bool IsValid() const { return Id != 0; }
+	bool operator==(const FReplicationSpawnBatchHandle& Other) const { return Id == Other.Id; }
+};